@@ -110,6 +110,11 @@ if (ENABLE_TEST AND STANDALONE_PROJECT)
     add_subdirectory(test)
 endif ()
 
+# build tools only for standalone project
+if (BUILD_TOOLS AND STANDALONE_PROJECT)
+    add_subdirectory(tools)
+endif ()
+
 # disable compiler warnings if project is not a standalone project
 if (NOT STANDALONE_PROJECT)
     unset(COMPILER_WARNINGS)
@@ -137,6 +142,11 @@ if (ENABLE_MULTITHREADING)
     target_link_libraries(${Target} PRIVATE Threads::Threads)
 endif ()
 
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+    # required by posix shared memory (shm_open) on older glibc versions
+    target_link_libraries(${Target} PRIVATE rt)
+endif ()
+
 # ----------------------------------------------- doxygen documentation ------------------------------------------------
 # ======================================================================================================================
 if (BUILD_DOC AND NOT STANDALONE_PROJECT)
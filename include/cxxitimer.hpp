@@ -5,11 +5,55 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <fstream>
+#include <memory>
 #include <sys/time.h>
+#include <system_error>
 
 namespace cxxitimer {
 
+/**
+ * @brief error codes of the non-throwing timer functions
+ * @details errors of system calls are reported with std::generic_category
+ */
+enum class timer_errc {
+    already_started = 1,    //* timer already started
+    already_stopped,        //* timer already stopped
+    negative_interval,      //* timer interval is negative
+    negative_value,         //* timer value is negative
+    interval_too_small,     //* invalid timer values due to a too small speed factor
+    negative_speed_factor,  //* negative speed factor
+    invalid_speed_factor,   //* speed factor is nan/inf
+};
+
+//* error category of timer_errc
+const std::error_category &timer_category() noexcept;
+
+//* create error code from timer_errc
+std::error_code make_error_code(timer_errc e) noexcept;
+
+/**
+ * @brief behavior of a running timer in the child process after fork
+ * @details the kernel does not inherit interval timers to the child process
+ */
+enum class ForkPolicy {
+    stop,     //* timer is stopped in the child, start() arms it with a full period (default)
+    restart,  //* timer is re-armed in the child with a full period
+    resume,   //* timer is re-armed in the child with the remaining value of the parent (same phase as the parent)
+};
+
+//* tag type of the constructors that adopt a timer handed over by ITimer::prepare_exec_handoff
+struct adopt_handoff_t {
+    explicit adopt_handoff_t() = default;
+};
+
+//* select the constructor that adopts a timer handed over by ITimer::prepare_exec_handoff
+inline constexpr adopt_handoff_t adopt_handoff {};
+
+class PendingSpeedHook;
+
 /**
  * @brief abstract class ITimer
  */
@@ -30,14 +74,57 @@ private:
      *   - ]0;1[   -->  slower
      *   - ]1;inf[ -->  faster
      *   - 1       -->  normal speed
+     *
+     * atomic: a coalesced speed factor is applied from the signal handler
      */
-    double speed_factor;
+    std::atomic<double> speed_factor;
 
     //* timer running indicator
     bool running;
 
-    //* internal use only!
-    virtual void adjust_speed(double new_factor);
+    //* minimum time between two speed adjustments of a running timer (nsec, 0: coalescing disabled)
+    long long coalescing_period = 0;
+
+    //* CLOCK_MONOTONIC time of the last speed adjustment (nsec)
+    long long last_adjustment = 0;
+
+    //* coalesced speed factor that is applied after the coalescing period (0: none)
+    std::atomic<double> pending_speed_factor {0.0};
+
+    //* serializes the controlling thread with the application of coalesced speed factors in the signal handler
+    mutable std::atomic_flag state_lock;
+
+    //* applies coalesced speed factors on the first expiration after the coalescing period
+    std::unique_ptr<PendingSpeedHook> pending_hook;
+
+    //* timer signal was blocked by prepare_exec_handoff
+    bool handoff_blocked_signal = false;
+
+    //* behavior in the child process after fork
+    ForkPolicy fork_policy = ForkPolicy::stop;
+
+    //* remaining timer value at fork (scaled, only with ForkPolicy::resume)
+    timeval fork_value {0, 0};
+
+    /**
+     * @brief internal use only!
+     * @details late_nsec: time that the timer ran with the old speed factor after the change (rescaled, too)
+     */
+    virtual void adjust_speed(double new_factor, std::int64_t late_nsec, std::error_code &ec) noexcept;
+
+    //* pthread_atfork prepare handler
+    static void on_fork_prepare() noexcept;
+
+    //* pthread_atfork child handler
+    static void on_fork_child() noexcept;
+
+    //* apply the coalesced speed factor if the coalescing period passed (state_lock must be held)
+    void apply_due_speed_factor() noexcept;
+
+    //* attach or detach pending_hook according to coalescing_period
+    void update_pending_hook();
+
+    friend class PendingSpeedHook;
 
 protected:
     //* internal use only!
@@ -52,6 +139,17 @@ protected:
     //* internal use only!
     ITimer(int type, double interval, double value) noexcept;
 
+    /**
+     * @brief internal use only!
+     * @details adopt the state stored by prepare_exec_handoff (if any) and remove it from the environment
+     * @return true state adopted
+     * @return false no state stored
+     */
+    bool adopt_handoff_state();
+
+    //* internal use only! (register instance for the fork handling)
+    void register_instance() noexcept;
+
 public:
     //! copying is not possible
     ITimer(const ITimer &other) = delete;
@@ -79,6 +177,13 @@ public:
      */
     void start();
 
+    /**
+     * @brief start timer (non-throwing)
+     * @param ec timer_errc::already_started, timer_errc::negative_interval, timer_errc::negative_value,
+     *           timer_errc::interval_too_small or errno of setitimer (std::generic_category)
+     */
+    void start(std::error_code &ec) noexcept;
+
     /**
      * @brief stop timer
      * @exception std::logic_error timer already stopped
@@ -86,6 +191,12 @@ public:
      */
     void stop();
 
+    /**
+     * @brief stop timer (non-throwing)
+     * @param ec timer_errc::already_stopped or errno of setitimer (std::generic_category)
+     */
+    void stop(std::error_code &ec) noexcept;
+
     /**
      * @brief set speed factor
      * @details is applied directly, even if the timer is running
@@ -98,6 +209,97 @@ public:
      */
     void set_speed_factor(double factor);
 
+    /**
+     * @brief set speed factor (non-throwing)
+     * @details is applied directly, even if the timer is running
+     * @param factor speed factor
+     * @param ec timer_errc::negative_speed_factor, timer_errc::invalid_speed_factor or errno of setitimer
+     *           (std::generic_category)
+     */
+    void set_speed_factor(double factor, std::error_code &ec) noexcept;
+
+    /**
+     * @brief set speed factor as of a past instant
+     * @details
+     *      Like set_speed_factor, but the speed factor is applied as if it had been set at since_nsec: the time the
+     *      timer ran with the old speed factor since then is rescaled, too.
+     *      If the corrected expiration already passed, the timer expires at the next time in the same phase
+     *      (expirations are not repeated or revoked).
+     *      Only ITIMER_REAL is corrected (the other timer types do not count CLOCK_MONOTONIC time).
+     *      Not coalesced: a recorded speed factor is discarded.
+     * @param factor speed factor
+     * @param since_nsec CLOCK_MONOTONIC time of the change (nsec, a future time is treated as now)
+     * @exception std::invalid_argument negative values or nan/inf
+     * @exception std::system_error call of setitimer failed
+     */
+    void set_speed_factor_since(double factor, std::int64_t since_nsec);
+
+    /**
+     * @brief set speed factor as of a past instant (non-throwing)
+     * @details see set_speed_factor_since(double, std::int64_t)
+     * @param factor speed factor
+     * @param since_nsec CLOCK_MONOTONIC time of the change (nsec)
+     * @param ec timer_errc::negative_speed_factor, timer_errc::invalid_speed_factor or errno of setitimer
+     *           (std::generic_category)
+     */
+    void set_speed_factor_since(double factor, std::int64_t since_nsec, std::error_code &ec) noexcept;
+
+    /**
+     * @brief enable coalescing of speed factor changes
+     * @details
+     *      If the speed factor of a running timer was adjusted less than min_period ago, set_speed_factor only records
+     *      the requested speed factor. The latest recorded speed factor is applied automatically on the first
+     *      expiration of the timer after min_period (from the signal handler, see TickHook), by the next
+     *      set_speed_factor call after min_period or explicitly by apply_pending_speed_factor.
+     *      Each applied adjustment is exact (the remaining timer value is scaled).
+     *
+     *      Enabling coalescing attaches a TickHook to the timer signal. Signal handlers that are installed afterwards
+     *      must chain the previous handler, otherwise recorded speed factors are only applied explicitly.
+     *      Disabling coalescing applies a recorded speed factor immediately.
+     * @param min_period minimum time between two adjustments ({0, 0}: disable coalescing)
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction or setitimer failed
+     */
+    void set_speed_coalescing(const timeval &min_period);
+
+    /**
+     * @brief enable coalescing of speed factor changes
+     * @param min_period minimum time between two adjustments (seconds, 0: disable coalescing)
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction or setitimer failed
+     */
+    void set_speed_coalescing(double min_period);
+
+    /**
+     * @brief apply recorded speed factor
+     * @return true speed factor applied
+     * @return false no speed factor recorded
+     * @exception std::system_error call of setitimer failed
+     */
+    bool apply_pending_speed_factor();
+
+    /**
+     * @brief apply recorded speed factor (non-throwing)
+     * @param ec errno of setitimer (std::generic_category)
+     * @return true speed factor applied
+     * @return false no speed factor recorded or error
+     */
+    bool apply_pending_speed_factor(std::error_code &ec) noexcept;
+
+    /**
+     * @brief check for recorded speed factor
+     * @return true a speed factor is recorded
+     * @return false no speed factor recorded
+     */
+    [[nodiscard]] inline bool has_pending_speed_factor() const noexcept { return pending_speed_factor.load() > 0.0; }
+
+    /**
+     * @brief get recorded speed factor
+     * @details the speed factor the timer runs with once the recorded speed factor is applied
+     * @return recorded speed factor (0 if none)
+     */
+    [[nodiscard]] inline double get_pending_speed_factor() const noexcept { return pending_speed_factor.load(); }
+
     /**
      * @brief set interval (timeval)
      * @details
@@ -138,21 +340,38 @@ public:
 
     /**
      * @brief set speed to normal
-     * @details like calling set_speed_factor with 1.0
+     * @details like calling set_speed_factor with 1.0, but applied immediately (no coalescing)
      * @exception std::system_error call of setitimer failed
      */
     void set_speed_to_normal();
 
+    /**
+     * @brief set speed to normal (non-throwing)
+     * @details like calling set_speed_factor with 1.0, but applied immediately (no coalescing)
+     * @param ec errno of setitimer (std::generic_category)
+     */
+    void set_speed_to_normal(std::error_code &ec) noexcept;
+
     /**
      * @brief write to binary file stream
      * @details
      * writes interval and value to file stream.
      * type and speed factor is not stored!
      * @param fstream file stream to write to
-     * @exception std::system_error call of getitimer failed
+     * @exception std::system_error call of getitimer failed or failed to write
      */
     void to_fstream(std::ofstream &fstream) const;
 
+    /**
+     * @brief write to binary file stream (non-throwing)
+     * @details
+     * writes interval and value to file stream.
+     * type and speed factor is not stored!
+     * @param fstream file stream to write to
+     * @param ec errno of getitimer (std::generic_category) or write error (std::iostream_category)
+     */
+    void to_fstream(std::ofstream &fstream, std::error_code &ec) const noexcept;
+
     /**
      * @brief read from binary filestream
      * @param fstream file stream to read from
@@ -160,6 +379,51 @@ public:
      */
     void from_fstream(std::ifstream &fstream);
 
+    /**
+     * @brief hand the timer over to the next process image
+     * @details
+     * Interval timers keep running across execve, but the state of this object does not. This function stores
+     * interval, value, speed factor and running state in the environment variable
+     * CXXITIMER_HANDOFF_<REAL|VIRTUAL|PROF>. The new image takes the timer over (without phase jump) by constructing
+     * the timer with adopt_handoff.
+     *
+     * execve resets the signal handlers and the default action of the timer signals terminates the process. Therefore,
+     * the timer signal is blocked for the calling thread (the signal mask is inherited by the new image).
+     * The new image has to unblock the signal after installing its handler (e.g. pthread_sigmask).
+     * Expirations while the signal is blocked are merged into one pending signal.
+     *
+     * Call this function directly before execv/execvp (from the thread that calls it) and do not destroy the timer
+     * object before (the destructor stops the timer). A recorded (coalesced) speed factor is not handed over.
+     * @exception std::system_error call of getitimer, pthread_sigmask or setenv failed (the signal mask is restored)
+     */
+    void prepare_exec_handoff();
+
+    /**
+     * @brief revert prepare_exec_handoff (e.g. if execve failed)
+     * @details removes the stored state and unblocks the timer signal if it was blocked by prepare_exec_handoff
+     * @exception std::system_error call of pthread_sigmask or unsetenv failed
+     */
+    void cancel_exec_handoff();
+
+    /**
+     * @brief set behavior in the child process after fork
+     * @details
+     * The child process has no interval timers armed. The timer object is adjusted by a pthread_atfork handler
+     * according to the policy. The inherited object can be used (or destroyed to create a new instance) in the child.
+     * A recorded (coalesced) speed factor is applied in the child.
+     *
+     * fork() must be called from the thread that controls the timers (start, stop, speed changes): the handler
+     * accesses the timer objects without synchronization.
+     * @param policy fork policy
+     */
+    inline void set_fork_policy(ForkPolicy policy) noexcept { fork_policy = policy; }
+
+    /**
+     * @brief get behavior in the child process after fork
+     * @return fork policy
+     */
+    [[nodiscard]] inline ForkPolicy get_fork_policy() const noexcept { return fork_policy; }
+
     /**
      * @brief get timer value
      * @details returns the stored timer value if the timer is stopped or the actual timer value if running
@@ -167,12 +431,45 @@ public:
      */
     [[nodiscard]] timeval get_timer_value() const;
 
+    /**
+     * @brief get timer value (non-throwing)
+     * @details returns the stored timer value if the timer is stopped or the actual timer value if running
+     * @param ec errno of getitimer (std::generic_category)
+     * @return timer value ({0, 0} on error)
+     */
+    [[nodiscard]] timeval get_timer_value(std::error_code &ec) const noexcept;
+
     /**
      * @brief check if timer is running
      * @return true timer is running
      * @return true timer is stopped
      */
     [[nodiscard]] inline bool is_running() const noexcept { return running; }
+
+    /**
+     * @brief get timer type
+     * @return timer type (ITIMER_REAL/ITIMER_VIRTUAL/ITIMER_PROF)
+     */
+    [[nodiscard]] inline int get_type() const noexcept { return type; }
+
+    /**
+     * @brief get the signal that is generated at each expiration
+     * @return signal number (SIGALRM/SIGVTALRM/SIGPROF)
+     */
+    [[nodiscard]] int get_signal() const noexcept;
+
+    /**
+     * @brief get current speed factor
+     * @details a recorded (coalesced) speed factor is not returned before it is applied
+     * @return speed factor
+     */
+    [[nodiscard]] inline double get_speed_factor() const noexcept { return speed_factor.load(); }
+
+    /**
+     * @brief get timer interval
+     * @return timer interval (speed factor 1.0)
+     */
+    [[nodiscard]] inline const timeval &get_interval() const noexcept { return timer_interval; }
 };
 
 /** @brief class ITimer_Real
@@ -220,6 +517,27 @@ public:
      */
     ITimer_Real(double interval, double value);
 
+    /**
+     * @brief create ITimer_Real instance that adopts a timer handed over by prepare_exec_handoff
+     * @details
+     * The timer is running if it was running in the previous process image. If no timer was handed over, the
+     * instance is created with the given interval (not started).
+     * @param interval timer interval (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Real(adopt_handoff_t, const timeval &interval);
+
+    /**
+     * @brief create ITimer_Real instance that adopts a timer handed over by prepare_exec_handoff
+     * @param interval timer interval in seconds (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Real(adopt_handoff_t, double interval);
+
     //* destroy instance
     ~ITimer_Real() override;
 
@@ -279,6 +597,27 @@ public:
      */
     ITimer_Virtual(double interval, double value);
 
+    /**
+     * @brief create ITimer_Virtual instance that adopts a timer handed over by prepare_exec_handoff
+     * @details
+     * The timer is running if it was running in the previous process image. If no timer was handed over, the
+     * instance is created with the given interval (not started).
+     * @param interval timer interval (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Virtual(adopt_handoff_t, const timeval &interval);
+
+    /**
+     * @brief create ITimer_Virtual instance that adopts a timer handed over by prepare_exec_handoff
+     * @param interval timer interval in seconds (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Virtual(adopt_handoff_t, double interval);
+
     //* destroy instance
     ~ITimer_Virtual() override;
 
@@ -341,6 +680,27 @@ public:
      */
     ITimer_Prof(double interval, double value);
 
+    /**
+     * @brief create ITimer_Prof instance that adopts a timer handed over by prepare_exec_handoff
+     * @details
+     * The timer is running if it was running in the previous process image. If no timer was handed over, the
+     * instance is created with the given interval (not started).
+     * @param interval timer interval (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Prof(adopt_handoff_t, const timeval &interval);
+
+    /**
+     * @brief create ITimer_Prof instance that adopts a timer handed over by prepare_exec_handoff
+     * @param interval timer interval in seconds (used if no timer was handed over)
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error invalid handoff state
+     * @exception std::system_error call of getitimer failed
+     */
+    ITimer_Prof(adopt_handoff_t, double interval);
+
     //* destroy instance
     ~ITimer_Prof() override;
 
@@ -385,3 +745,6 @@ double timeval_to_double(const timeval &time) noexcept;
 timeval double_to_timeval(double time) noexcept;
 
 }  // namespace cxxitimer
+
+template <>
+struct std::is_error_code_enum<cxxitimer::timer_errc> : std::true_type {};
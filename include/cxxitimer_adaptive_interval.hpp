@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer.hpp"
+
+#include <chrono>
+#include <cstddef>
+
+namespace cxxitimer {
+
+/**
+ * @brief class AdaptiveInterval
+ *
+ * @details
+ * Adjusts the effective period of a periodic timer within configured bounds based on the observed handler load.
+ * The effective period (interval / speed factor) is changed via the speed factor.
+ * Therefore, it can be adjusted while the timer is running. A coalesced speed factor that is not applied yet
+ * (ITimer::set_speed_coalescing) is taken into account.
+ *
+ * The handler reports its duration and backlog (e.g. number of pending items) with record().
+ * After each window of observations, the averages are evaluated:
+ *   - load (duration / period) above high_load  -->  lengthen period (handler cannot keep up)
+ *   - backlog                                   -->  shorten period (drain the backlog)
+ *   - load below low_load and no backlog        -->  lengthen period (idle)
+ *
+ * Note: an idle handler lengthens the period instead of shortening it. Polling at a short period while there is no
+ * work wastes CPU time; a backlog shortens the period again.
+ */
+class AdaptiveInterval {
+public:
+    //* controller parameters
+    struct Parameters {
+        //* minimum effective period (seconds)
+        double min_period = 0.001;
+
+        //* maximum effective period (seconds)
+        double max_period = 1.0;
+
+        //* load (handler duration / period) above which the period is lengthened
+        double high_load = 0.8;
+
+        //* load below which the period is lengthened if there is no backlog
+        double low_load = 0.1;
+
+        //* factor by which the period is lengthened
+        double lengthen_factor = 1.25;
+
+        //* factor by which the period is shortened
+        double shorten_factor = 0.8;
+
+        //* number of observations per evaluation
+        std::size_t window = 8;
+    };
+
+private:
+    //* controlled timer
+    ITimer &timer;
+
+    //* controller parameters
+    Parameters parameters;
+
+    //* sum of the handler durations in the current window (seconds)
+    double duration_sum = 0.0;
+
+    //* sum of the backlogs in the current window
+    std::size_t backlog_sum = 0;
+
+    //* number of observations in the current window
+    std::size_t observations = 0;
+
+public:
+    /**
+     * @brief create controller
+     * @param timer controlled timer
+     * @param parameters controller parameters
+     * @exception std::invalid_argument invalid parameters
+     */
+    AdaptiveInterval(ITimer &timer, const Parameters &parameters);
+
+    /**
+     * @brief record handler execution
+     * @param duration handler duration
+     * @param backlog work left after the handler execution
+     * @return true period changed
+     * @return false period unchanged
+     * @exception std::system_error call of setitimer failed
+     */
+    bool record(std::chrono::nanoseconds duration, std::size_t backlog = 0);
+
+    /**
+     * @brief get effective period
+     * @return timer interval / speed factor (seconds, pending speed factor if a change is coalesced)
+     */
+    [[nodiscard]] double get_period() const noexcept;
+
+private:
+    //* set effective period (bounded)
+    bool set_period(double period);
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <chrono>
+
+namespace cxxitimer {
+
+/**
+ * @brief class CoarseClock
+ *
+ * @details
+ * Wall clock time (CLOCK_REALTIME) that is cached on each expiration of an ITimer_Real.
+ * Reading the time is a single atomic load. The precision is limited to the timer interval.
+ *
+ * Satisfies the requirements of Clock (std::chrono).
+ * now() returns 0 (epoch) if no instance exists.
+ */
+class CoarseClock : public TickHook {
+    //* only one instance per process allowed
+    static bool instance_exists;
+
+public:
+    using duration   = std::chrono::system_clock::duration;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::system_clock::time_point;
+
+    static constexpr bool is_steady = false;
+
+    /**
+     * @brief create CoarseClock instance
+     * @details only one instance is allowed. The cached time is updated on each expiration of the timer.
+     * @param timer timer that updates the cached time
+     * @exception std::logic_error instance exists
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit CoarseClock(const ITimer_Real &timer);
+
+    //* destroy instance
+    ~CoarseClock() override;
+
+    //* copying is not possible
+    CoarseClock(const CoarseClock &other) = delete;
+    //* moving is not possible
+    CoarseClock(CoarseClock &&other) = delete;
+    //* copying is not possible
+    CoarseClock &operator=(const CoarseClock &other) = delete;
+    //* moving is not possible
+    CoarseClock &operator=(CoarseClock &&other) = delete;
+
+    /**
+     * @brief get cached time
+     * @return time of the last update
+     */
+    [[nodiscard]] static time_point now() noexcept;
+
+    /**
+     * @brief get cached time (timeval)
+     * @return time of the last update
+     */
+    [[nodiscard]] static timeval now_timeval() noexcept;
+
+    /**
+     * @brief update cached time
+     * @details async-signal-safe
+     */
+    static void update() noexcept;
+
+    //* internal use only!
+    inline void on_tick(void *) noexcept override { update(); }
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_queue_dispatcher.hpp"
+
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace cxxitimer {
+
+/**
+ * @brief exception that is stored in the future of a DeadlinePromise if the timeout expired
+ */
+class timeout_error : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief class DeadlinePromise
+ *
+ * @details
+ * Promise with a timeout that is registered on the timer queue of a QueueDispatcher (no thread, no blocking wait).
+ * If the promise is not completed before the timeout expires, a timeout_error is stored in the future.
+ *
+ * A DeadlinePromise is a copyable handle to a shared state. The first completion (value, exception or timeout) wins,
+ * all later completions are ignored. Therefore, when-any semantics are achieved by passing copies of the same promise
+ * to several producers (e.g. an RPC fan-out where the first response wins).
+ *
+ * All member functions can be called concurrently from any thread (but not from signal handlers).
+ * The dispatcher must outlive all copies of the promise.
+ *
+ * @tparam T value type
+ */
+template <typename T>
+class DeadlinePromise {
+private:
+    //* shared state
+    struct State {
+        //* promise
+        std::promise<T> promise;
+
+        //* set by the first completion
+        std::atomic<bool> completed {false};
+
+        //* timer queue
+        QueueDispatcher &dispatcher;
+
+        //* timeout timer
+        QueueDispatcher::timer_id timer = TimerQueue::INVALID_ID;
+
+        explicit State(QueueDispatcher &_dispatcher) noexcept : dispatcher(_dispatcher) {}
+    };
+
+    //* shared state
+    std::shared_ptr<State> state;
+
+public:
+    /**
+     * @brief create promise
+     * @param dispatcher timer queue (clock domain of the timeout)
+     * @param timeout timeout
+     * @exception std::system_error call of setitimer failed
+     */
+    DeadlinePromise(QueueDispatcher &dispatcher, std::chrono::nanoseconds timeout)
+        : state(std::make_shared<State>(dispatcher)) {
+        // the timer keeps the state alive until it expires or is canceled
+        state->timer = dispatcher.schedule_after(timeout, [state = state] {
+            if (state->completed.exchange(true, std::memory_order_acq_rel)) return;
+            state->promise.set_exception(std::make_exception_ptr(timeout_error("deadline expired")));
+        });
+    }
+
+    /**
+     * @brief get future
+     * @details can only be called once (for all copies of the promise)
+     * @return future
+     * @exception std::future_error future already retrieved
+     */
+    [[nodiscard]] std::future<T> get_future() { return state->promise.get_future(); }
+
+    /**
+     * @brief complete the promise with a value
+     * @param args value (none for DeadlinePromise<void>)
+     * @return true value stored
+     * @return false promise already completed (e.g. timeout expired)
+     * @exception std::system_error call of setitimer failed
+     */
+    template <typename... Args>
+    bool set_value(Args &&...args) {
+        if (!complete()) return false;
+        state->promise.set_value(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /**
+     * @brief complete the promise with an exception
+     * @param exception exception
+     * @return true exception stored
+     * @return false promise already completed (e.g. timeout expired)
+     * @exception std::system_error call of setitimer failed
+     */
+    bool set_exception(std::exception_ptr exception) {
+        if (!complete()) return false;
+        state->promise.set_exception(std::move(exception));
+        return true;
+    }
+
+    /**
+     * @brief check if the promise is completed
+     * @return true promise completed (value, exception or timeout)
+     * @return false promise not completed
+     */
+    [[nodiscard]] bool is_completed() const noexcept { return state->completed.load(std::memory_order_acquire); }
+
+private:
+    //* claim the completion and cancel the timeout timer
+    bool complete() {
+        if (state->completed.exchange(true, std::memory_order_acq_rel)) return false;
+        state->dispatcher.cancel(state->timer);
+        return true;
+    }
+};
+
+/**
+ * @brief create a promise with a timeout and get its future
+ * @param dispatcher timer queue (clock domain of the timeout)
+ * @param timeout timeout
+ * @return promise and future
+ * @exception std::system_error call of setitimer failed
+ */
+template <typename T>
+std::pair<DeadlinePromise<T>, std::future<T>> with_timeout(QueueDispatcher         &dispatcher,
+                                                           std::chrono::nanoseconds timeout) {
+    DeadlinePromise<T> promise(dispatcher, timeout);
+    auto               future = promise.get_future();
+    return {std::move(promise), std::move(future)};
+}
+
+/**
+ * @brief start several producers and get the result of the first one that completes before the timeout
+ * @details each producer is called with a copy of the same promise (e.g. to send one request of an RPC fan-out)
+ * @param dispatcher timer queue (clock domain of the timeout)
+ * @param timeout timeout
+ * @param producers range of callables that accept a DeadlinePromise<T>
+ * @return future
+ * @exception std::system_error call of setitimer failed
+ */
+template <typename T, typename Producers>
+std::future<T>
+        when_any_or_timeout(QueueDispatcher &dispatcher, std::chrono::nanoseconds timeout, Producers &&producers) {
+    auto [promise, future] = with_timeout<T>(dispatcher, timeout);
+    for (auto &producer : producers)
+        producer(promise);
+    return std::move(future);
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace cxxitimer {
+
+class SharedTickReader;
+
+/**
+ * @brief class SpeedDiscipline
+ *
+ * @details
+ * Phase locked loop that adjusts the speed factor of a timer continuously to track a reference time source.
+ *
+ * update() must be called once per expiration (e.g. after TickBroadcast::wait_for_tick).
+ * The n-th expiration after reset() is expected at reference time t0 + n * interval / nominal speed factor.
+ * The phase error is fed into a PI controller. The resulting speed factor is bounded in its deviation from the nominal
+ * speed factor and in its change per update (slew).
+ */
+class SpeedDiscipline {
+public:
+    /**
+     * @brief reference time source
+     * @details returns the current reference time (nsec) or std::nullopt if the reference is unavailable
+     */
+    using reference_source_t = std::function<std::optional<std::int64_t>()>;
+
+    //* controller parameters
+    struct Parameters {
+        //* proportional gain (speed factor correction per period of phase error)
+        double proportional_gain = 0.1;
+
+        //* integral gain (speed factor correction per period of phase error and update)
+        double integral_gain = 0.005;
+
+        //* maximum relative deviation of the speed factor from the nominal speed factor
+        double max_deviation = 0.01;
+
+        //* maximum relative change of the speed factor per update
+        double max_slew = 0.001;
+    };
+
+private:
+    //* disciplined timer
+    ITimer &timer;
+
+    //* reference time source
+    reference_source_t reference;
+
+    //* controller parameters
+    Parameters parameters;
+
+    //* speed factor without correction
+    double nominal_speed;
+
+    //* expected reference time between two expirations (nsec)
+    double period_nsec;
+
+    //* reference time of the first expiration after reset (nsec)
+    std::optional<std::int64_t> start_time;
+
+    //* tick count of the last update
+    std::uint32_t last_tick = 0;
+
+    //* number of expirations since the first expiration after reset (widened, does not wrap)
+    std::uint64_t ticks = 0;
+
+    //* integral term
+    double integral = 0.0;
+
+    //* phase error of the last update (seconds)
+    double phase_error = 0.0;
+
+public:
+    /**
+     * @brief create discipline loop
+     * @details the current speed factor of the timer is used as nominal speed factor
+     * @param timer disciplined timer
+     * @param reference reference time source
+     * @param parameters controller parameters
+     * @exception std::invalid_argument invalid parameters
+     */
+    SpeedDiscipline(ITimer &timer, reference_source_t reference, const Parameters &parameters);
+
+    /**
+     * @brief create discipline loop with default parameters
+     * @details the current speed factor of the timer is used as nominal speed factor
+     * @param timer disciplined timer
+     * @param reference reference time source
+     */
+    SpeedDiscipline(ITimer &timer, reference_source_t reference);
+
+    /**
+     * @brief process expiration
+     * @param tick_count number of expirations (arbitrary start, e.g. TickBroadcast sequence number; wraps modulo 2^32)
+     * @return true speed factor updated
+     * @return false reference unavailable or first expiration after reset
+     * @exception std::system_error call of setitimer failed
+     */
+    bool update(std::uint32_t tick_count);
+
+    /**
+     * @brief restart phase tracking
+     * @details the next update defines the new phase reference. The speed factor is reset to the nominal speed factor.
+     * @exception std::system_error call of setitimer failed
+     */
+    void reset();
+
+    /**
+     * @brief get phase error of the last update
+     * @return phase error (seconds). Positive: expirations are late.
+     */
+    [[nodiscard]] inline double get_phase_error() const noexcept { return phase_error; }
+
+    /**
+     * @brief get nominal speed factor
+     * @return nominal speed factor
+     */
+    [[nodiscard]] inline double get_nominal_speed() const noexcept { return nominal_speed; }
+
+    /**
+     * @brief reference time source: decimal timestamps in a file
+     * @details
+     *      The file contains the reference time (nsec) and optionally the CLOCK_MONOTONIC time (nsec) at which the
+     *      reference time was taken, separated by whitespace. If both are present, the reference time is extrapolated.
+     * @param path file path
+     * @return reference time source
+     */
+    static reference_source_t file_reference(std::string path);
+
+    /**
+     * @brief reference time source: wall clock time of the process that drives a SharedTickSource
+     * @details extrapolated from the last published tick
+     * @param reader reader (must outlive the reference time source)
+     * @return reference time source
+     */
+    static reference_source_t shared_tick_reference(const SharedTickReader &reader);
+};
+
+}  // namespace cxxitimer
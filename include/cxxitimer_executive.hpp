@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief class RateExecutive
+ *
+ * @details
+ * Cyclic executive for periodic tasks whose periods are multiples of a base period (the interval of the timer).
+ * All tasks are driven by one timer at the base rate.
+ *
+ * build() computes the hyperperiod (least common multiple of all periods) and a table that contains the tasks of each
+ * slot (base period) of the hyperperiod. On each expiration, only the tasks of the current slot are executed.
+ * Within a slot, tasks are executed in rate monotonic order (shortest period first).
+ */
+class RateExecutive {
+public:
+    //* periodic task
+    using task_t = std::function<void()>;
+
+private:
+    //* registered task
+    struct Task {
+        //* task function
+        task_t task;
+
+        //* period (multiple of the base period)
+        unsigned period;
+
+        //* slot of the first execution within the period
+        unsigned offset;
+    };
+
+    //* registered tasks
+    std::vector<Task> tasks;
+
+    //* index of the first entry of each slot in slot_tasks (hyperperiod + 1 entries)
+    std::vector<std::size_t> slot_begin;
+
+    //* task indices of all slots
+    std::vector<std::size_t> slot_tasks;
+
+    //* current slot
+    std::size_t slot = 0;
+
+    //* base period
+    timeval base_period;
+
+    //* notifies about expirations of the timer
+    TickBroadcast broadcast;
+
+    //* last processed tick sequence number
+    std::uint32_t sequence;
+
+    //* number of expirations that were processed late (more than one slot per wait_and_run)
+    std::uint64_t overruns = 0;
+
+public:
+    /**
+     * @brief create executive
+     * @details the interval of the timer is the base period. Changes of the interval after creation are ignored.
+     * @param timer timer that drives the executive
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit RateExecutive(const ITimer_Real &timer);
+
+    //* destroy executive
+    ~RateExecutive();
+
+    //* copying is not possible
+    RateExecutive(const RateExecutive &other) = delete;
+    //* moving is not possible
+    RateExecutive(RateExecutive &&other) = delete;
+    //* copying is not possible
+    RateExecutive &operator=(const RateExecutive &other) = delete;
+    //* moving is not possible
+    RateExecutive &operator=(RateExecutive &&other) = delete;
+
+    /**
+     * @brief add task
+     * @details invalidates the slot table (call build() afterwards)
+     * @param period period as multiple of the base period
+     * @param task task
+     * @param offset slot of the first execution within the period (to distribute the load)
+     * @exception std::invalid_argument period is 0 or offset >= period
+     */
+    void add_task(unsigned period, task_t task, unsigned offset = 0);
+
+    /**
+     * @brief add task
+     * @details invalidates the slot table (call build() afterwards)
+     * @param period period (must be a multiple of the base period)
+     * @param task task
+     * @exception std::invalid_argument period is not a multiple of the base period
+     */
+    void add_task(const timeval &period, task_t task);
+
+    /**
+     * @brief compute hyperperiod and slot table
+     * @details the executive restarts with slot 0 at the next expiration (previous expirations are not caught up)
+     * @exception std::logic_error no tasks
+     * @exception std::overflow_error hyperperiod too large
+     */
+    void build();
+
+    /**
+     * @brief execute the tasks of the current slot and advance to the next slot
+     * @exception std::logic_error slot table not built
+     */
+    void run_slot();
+
+    /**
+     * @brief wait for the next expiration and execute the tasks of all slots that are due
+     * @details missed expirations are caught up (counted as overruns)
+     * @return number of executed slots
+     * @exception std::logic_error slot table not built
+     */
+    std::uint32_t wait_and_run();
+
+    /**
+     * @brief get hyperperiod
+     * @return hyperperiod as multiple of the base period (0 if not built)
+     */
+    [[nodiscard]] inline std::size_t get_hyperperiod() const noexcept {
+        return slot_begin.empty() ? 0 : slot_begin.size() - 1;
+    }
+
+    /**
+     * @brief get number of overruns
+     * @return number of expirations that were not processed in time
+     */
+    [[nodiscard]] inline std::uint64_t get_overruns() const noexcept { return overruns; }
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+#include "cxxitimer_tsc.hpp"
+
+#include <cstdint>
+#include <functional>
+
+namespace cxxitimer {
+
+/**
+ * @brief class FixedStepLoop
+ *
+ * @details
+ * Fixed timestep simulation loop (accumulator based) that is driven by a timer.
+ *
+ * On each expiration, the elapsed real time is scaled by the speed factor of the timer (slow motion/fast forward) and
+ * added to the accumulator. The step function is called once per full step in the accumulator.
+ * Afterwards the render function is called with the interpolation factor (remaining accumulator / step).
+ *
+ * Overload handling: at most max_catch_up steps are executed per expiration. Simulation time that exceeds this limit
+ * is dropped (the simulation slows down instead of falling further behind).
+ */
+class FixedStepLoop {
+public:
+    //* simulation step (argument: step size in seconds)
+    using step_t = std::function<void(double)>;
+
+    //* render function (argument: interpolation factor [0;1[ between the previous and the current state)
+    using render_t = std::function<void(double)>;
+
+private:
+    //* timer that drives the loop
+    const ITimer &timer;
+
+    //* step size (seconds)
+    double step_size;
+
+    //* simulation step
+    step_t step;
+
+    //* render function
+    render_t render;
+
+    //* maximum number of steps per expiration
+    unsigned max_catch_up;
+
+    //* simulation time that was not simulated yet (seconds)
+    double accumulator = 0.0;
+
+    //* simulation time (seconds)
+    double simulation_time = 0.0;
+
+    //* number of executed steps
+    std::uint64_t steps = 0;
+
+    //* simulation time that was dropped due to overload (seconds)
+    double dropped_time = 0.0;
+
+    //* notifies about expirations of the timer
+    TickBroadcast broadcast;
+
+    //* last processed tick sequence number
+    std::uint32_t sequence;
+
+    //* time of the last expiration
+    TscClock::time_point last_time;
+
+public:
+    /**
+     * @brief create loop
+     * @param timer timer that drives the loop (its speed factor scales the simulation time)
+     * @param step_size step size (seconds)
+     * @param step simulation step
+     * @param render render function (optional)
+     * @param max_catch_up maximum number of steps per expiration
+     * @exception std::invalid_argument step size not positive, max_catch_up is 0 or no step function
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    FixedStepLoop(const ITimer &timer, double step_size, step_t step, render_t render = {}, unsigned max_catch_up = 5);
+
+    //* destroy loop
+    ~FixedStepLoop();
+
+    //* copying is not possible
+    FixedStepLoop(const FixedStepLoop &other) = delete;
+    //* moving is not possible
+    FixedStepLoop(FixedStepLoop &&other) = delete;
+    //* copying is not possible
+    FixedStepLoop &operator=(const FixedStepLoop &other) = delete;
+    //* moving is not possible
+    FixedStepLoop &operator=(FixedStepLoop &&other) = delete;
+
+    /**
+     * @brief wait for the next expiration and advance the simulation by the elapsed (scaled) time
+     * @return number of executed steps
+     */
+    unsigned wait_and_run();
+
+    /**
+     * @brief advance the simulation
+     * @param elapsed simulation time to advance (seconds, already scaled)
+     * @return number of executed steps
+     */
+    unsigned advance(double elapsed);
+
+    /**
+     * @brief get interpolation factor
+     * @return remaining accumulator / step size
+     */
+    [[nodiscard]] inline double get_alpha() const noexcept { return accumulator / step_size; }
+
+    /**
+     * @brief get simulation time
+     * @return simulated time (seconds)
+     */
+    [[nodiscard]] inline double get_simulation_time() const noexcept { return simulation_time; }
+
+    /**
+     * @brief get number of executed steps
+     * @return number of executed steps
+     */
+    [[nodiscard]] inline std::uint64_t get_steps() const noexcept { return steps; }
+
+    /**
+     * @brief get dropped simulation time
+     * @return simulation time that was dropped due to overload (seconds)
+     */
+    [[nodiscard]] inline double get_dropped_time() const noexcept { return dropped_time; }
+};
+
+}  // namespace cxxitimer
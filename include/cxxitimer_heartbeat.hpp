@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unordered_map>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief class PhiAccrualDetector
+ *
+ * @details
+ * Phi accrual failure detector.
+ * Instead of a binary decision, a suspicion level phi is calculated from the distribution of the heartbeat
+ * inter-arrival times (normal distribution). phi = 1 means a probability of about 10% that the suspicion is wrong,
+ * phi = 2 about 1%, phi = 3 about 0.1% and so on.
+ *
+ * The inter-arrival times are kept in a window of fixed size.
+ */
+class PhiAccrualDetector {
+public:
+    //* time (CLOCK_MONOTONIC)
+    using time_point = std::chrono::nanoseconds;
+
+    //* detector parameters
+    struct Parameters {
+        //* number of inter-arrival times used for the estimation of the distribution
+        std::size_t window = 100;
+
+        //* minimum standard deviation (seconds)
+        double min_std_deviation = 0.1;
+
+        //* additional pause that is tolerated (seconds)
+        double acceptable_pause = 0.0;
+
+        //* estimated inter-arrival time used before the first heartbeat interval is known (seconds)
+        double first_interval_estimate = 1.0;
+    };
+
+private:
+    //* detector parameters
+    Parameters parameters;
+
+    //* inter-arrival times (seconds, ring buffer)
+    std::vector<double> intervals;
+
+    //* next entry of the ring buffer to overwrite
+    std::size_t next = 0;
+
+    //* sum of the inter-arrival times
+    double sum = 0.0;
+
+    //* sum of the squared inter-arrival times
+    double sum_of_squares = 0.0;
+
+    //* time of the last heartbeat
+    time_point last_heartbeat {0};
+
+    //* number of received heartbeats
+    std::uint64_t heartbeat_count = 0;
+
+public:
+    /**
+     * @brief create detector
+     * @param parameters detector parameters
+     * @exception std::invalid_argument invalid parameters
+     */
+    explicit PhiAccrualDetector(const Parameters &parameters);
+
+    /**
+     * @brief record heartbeat
+     * @param time arrival time of the heartbeat
+     */
+    void heartbeat(time_point time);
+
+    /**
+     * @brief calculate suspicion level
+     * @param now current time
+     * @return suspicion level phi (0 if no heartbeat was received yet)
+     */
+    [[nodiscard]] double phi(time_point now) const noexcept;
+
+    /**
+     * @brief get mean inter-arrival time
+     * @return mean inter-arrival time (seconds)
+     */
+    [[nodiscard]] double get_mean() const noexcept;
+
+    /**
+     * @brief get time of the last heartbeat
+     * @return time of the last heartbeat
+     */
+    [[nodiscard]] inline time_point get_last_heartbeat() const noexcept { return last_heartbeat; }
+
+    /**
+     * @brief get number of received heartbeats
+     * @return number of received heartbeats
+     */
+    [[nodiscard]] inline std::uint64_t get_heartbeat_count() const noexcept { return heartbeat_count; }
+
+private:
+    //* add inter-arrival time to the window
+    void add_interval(double interval) noexcept;
+};
+
+/**
+ * @brief class HeartbeatSender
+ *
+ * @details
+ * Sends a heartbeat datagram to a HeartbeatMonitor (UNIX domain socket) on each expiration of a timer.
+ * The datagram is sent directly from the signal handler (sendto is async-signal-safe). No thread is required.
+ * Send errors (e.g. monitor not running) are ignored.
+ */
+class HeartbeatSender : public TickHook {
+private:
+    //* socket
+    int fd;
+
+    //* address of the monitor
+    sockaddr_un address {};
+
+    //* sender id
+    std::uint32_t id;
+
+    //* heartbeat sequence number (the handler may execute concurrently in several threads)
+    std::atomic<std::uint64_t> sequence {0};
+
+public:
+    /**
+     * @brief create sender
+     * @param timer timer that schedules the heartbeats
+     * @param path socket path of the monitor
+     * @param id sender id
+     * @exception std::invalid_argument socket path too long
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of socket or sigaction failed
+     */
+    HeartbeatSender(const ITimer &timer, const std::string &path, std::uint32_t id);
+
+    //* destroy sender
+    ~HeartbeatSender() override;
+
+    //* copying is not possible
+    HeartbeatSender(const HeartbeatSender &other) = delete;
+    //* moving is not possible
+    HeartbeatSender(HeartbeatSender &&other) = delete;
+    //* copying is not possible
+    HeartbeatSender &operator=(const HeartbeatSender &other) = delete;
+    //* moving is not possible
+    HeartbeatSender &operator=(HeartbeatSender &&other) = delete;
+
+    /**
+     * @brief send a heartbeat
+     * @details async-signal-safe
+     */
+    void send() noexcept;
+
+    //* internal use only!
+    inline void on_tick(void *) noexcept override { send(); }
+};
+
+/**
+ * @brief class HeartbeatMonitor
+ *
+ * @details
+ * Receives heartbeats of any number of HeartbeatSenders (UNIX domain datagram socket) and checks them with a phi
+ * accrual failure detector per sender on each expiration of a timer.
+ *
+ * The callback is invoked if a sender becomes suspected (phi above the threshold) or is no longer suspected.
+ * Senders are registered with their first heartbeat.
+ *
+ * The monitor is not thread safe.
+ */
+class HeartbeatMonitor {
+public:
+    //* monitor parameters
+    struct Parameters {
+        //* phi threshold above which a sender is suspected
+        double threshold = 8.0;
+
+        //* parameters of the detectors
+        PhiAccrualDetector::Parameters detector;
+    };
+
+    //* callback (sender id, true: suspected/false: no longer suspected)
+    using callback_t = std::function<void(std::uint32_t, bool)>;
+
+private:
+    //* monitored sender
+    struct Member {
+        //* failure detector
+        PhiAccrualDetector detector;
+
+        //* true if the sender is suspected
+        bool suspected;
+    };
+
+    //* socket path
+    std::string path;
+
+    //* socket
+    int fd;
+
+    //* device of the socket file
+    dev_t socket_dev;
+
+    //* inode of the socket file (removed only if the path still refers to it)
+    ino_t socket_ino;
+
+    //* monitor parameters
+    Parameters parameters;
+
+    //* state change callback
+    callback_t callback;
+
+    //* monitored senders
+    std::unordered_map<std::uint32_t, Member> members;
+
+    //* notifies about expirations of the timer
+    TickBroadcast broadcast;
+
+    //* last processed tick sequence number
+    std::uint32_t tick_sequence;
+
+public:
+    /**
+     * @brief create monitor
+     * @details an existing socket at path is replaced if no process is bound to it (stale socket of a previous monitor)
+     * @param timer timer that schedules the checks
+     * @param path socket path
+     * @param callback state change callback
+     * @param parameters monitor parameters
+     * @exception std::invalid_argument socket path too long or invalid parameters
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error path exists and is not a stale socket (EADDRINUSE) or call of socket, bind, stat
+     *            or sigaction failed
+     */
+    HeartbeatMonitor(const ITimer &timer, std::string path, callback_t callback, const Parameters &parameters);
+
+    /**
+     * @brief create monitor with default parameters
+     * @param timer timer that schedules the checks
+     * @param path socket path
+     * @param callback state change callback
+     */
+    HeartbeatMonitor(const ITimer &timer, std::string path, callback_t callback);
+
+    //* destroy monitor (removes the socket file if it was not replaced)
+    ~HeartbeatMonitor();
+
+    //* copying is not possible
+    HeartbeatMonitor(const HeartbeatMonitor &other) = delete;
+    //* moving is not possible
+    HeartbeatMonitor(HeartbeatMonitor &&other) = delete;
+    //* copying is not possible
+    HeartbeatMonitor &operator=(const HeartbeatMonitor &other) = delete;
+    //* moving is not possible
+    HeartbeatMonitor &operator=(HeartbeatMonitor &&other) = delete;
+
+    /**
+     * @brief receive all pending heartbeats
+     * @return number of received heartbeats
+     */
+    std::size_t receive();
+
+    /**
+     * @brief check all senders and invoke the callback for each state change
+     */
+    void check();
+
+    /**
+     * @brief wait for the next expiration, receive pending heartbeats and check all senders
+     */
+    void wait_and_check();
+
+    /**
+     * @brief get suspicion level of a sender
+     * @param id sender id
+     * @return suspicion level phi
+     * @exception std::out_of_range unknown sender
+     */
+    [[nodiscard]] double get_phi(std::uint32_t id) const;
+
+    /**
+     * @brief check if a sender is suspected
+     * @param id sender id
+     * @return true sender suspected
+     * @return false sender not suspected
+     * @exception std::out_of_range unknown sender
+     */
+    [[nodiscard]] bool is_suspected(std::uint32_t id) const;
+
+    /**
+     * @brief stop monitoring a sender (until its next heartbeat)
+     * @param id sender id
+     * @return true sender removed
+     * @return false unknown sender
+     */
+    bool remove(std::uint32_t id) noexcept;
+
+    /**
+     * @brief get number of monitored senders
+     * @return number of monitored senders
+     */
+    [[nodiscard]] inline std::size_t size() const noexcept { return members.size(); }
+
+    /**
+     * @brief get socket file descriptor
+     * @details can be used to receive heartbeats as soon as they arrive (e.g. with poll)
+     * @return file descriptor
+     */
+    [[nodiscard]] inline int get_fd() const noexcept { return fd; }
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_queue_dispatcher.hpp"
+#include "cxxitimer_tick.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief class TimerStats
+ *
+ * @details
+ * Counts the expirations of a timer and records the lateness of the ticks of an ITimer_Real in a histogram.
+ *
+ * The lateness of a tick is the time between its expected arrival (phase of the first observed tick plus a multiple of
+ * the period) and its arrival in the signal handler (CLOCK_MONOTONIC). Expirations that are skipped completely
+ * (e.g. because the signal was blocked) are counted as missed. Early ticks are counted as on time and keep the phase.
+ * The phase is reset by update_period() if the effective period (interval of the kernel timer, i.e. interval / speed
+ * factor truncated to usec) changed.
+ * Timers of the types ITIMER_VIRTUAL and ITIMER_PROF count CPU time: only their expirations are counted.
+ */
+class TimerStats : public TickHook {
+public:
+    //* number of histogram buckets (bucket i: lateness < 2^i usec, last bucket: all larger values)
+    static constexpr std::size_t LATENESS_BUCKETS = 16;
+
+    //* lateness histogram
+    using histogram_t = std::array<std::uint64_t, LATENESS_BUCKETS>;
+
+private:
+    //* observed timer
+    const ITimer &timer;
+
+    //* effective period (nsec, 0: lateness not recorded)
+    std::atomic<std::int64_t> period {0};
+
+    //* expected arrival of the next tick (CLOCK_MONOTONIC, nsec, 0: phase unknown)
+    std::atomic<std::int64_t> expected {0};
+
+    //* number of expirations
+    std::atomic<std::uint64_t> expirations {0};
+
+    //* number of missed expirations
+    std::atomic<std::uint64_t> missed {0};
+
+    //* lateness histogram
+    std::array<std::atomic<std::uint64_t>, LATENESS_BUCKETS> lateness {};
+
+public:
+    /**
+     * @brief create statistics attached to the signal of a timer
+     * @param timer timer
+     * @exception std::logic_error hook already attached
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit TimerStats(const ITimer &timer);
+
+    //* destroy instance
+    ~TimerStats() override;
+
+    //* copying is not possible
+    TimerStats(const TimerStats &other) = delete;
+    //* moving is not possible
+    TimerStats(TimerStats &&other) = delete;
+    //* copying is not possible
+    TimerStats &operator=(const TimerStats &other) = delete;
+    //* moving is not possible
+    TimerStats &operator=(TimerStats &&other) = delete;
+
+    /**
+     * @brief update the effective period from the kernel timer
+     * @details
+     * Call after changes of the interval or speed factor (from the thread that controls the timer).
+     * Resets the phase if the period changed or the timer is stopped.
+     */
+    void update_period() noexcept;
+
+    /**
+     * @brief get number of expirations
+     * @return number of expirations
+     */
+    [[nodiscard]] inline std::uint64_t get_expirations() const noexcept { return expirations.load(); }
+
+    /**
+     * @brief get number of missed expirations
+     * @return number of missed expirations
+     */
+    [[nodiscard]] inline std::uint64_t get_missed() const noexcept { return missed.load(); }
+
+    /**
+     * @brief get lateness histogram
+     * @return number of ticks per bucket (bucket i: lateness < 2^i usec)
+     */
+    [[nodiscard]] histogram_t get_lateness() const noexcept;
+
+    /**
+     * @brief get observed timer
+     * @return timer
+     */
+    [[nodiscard]] inline const ITimer &get_timer() const noexcept { return timer; }
+
+    //* internal use only!
+    void on_tick(void *) noexcept override;
+};
+
+/**
+ * @brief class IntrospectionServer
+ *
+ * @details
+ * Serves the live state of registered timers and queues on a UNIX domain stream socket.
+ * Each client that connects receives a text report and the connection is closed (e.g. socat - UNIX-CONNECT:path).
+ *
+ * Report lines:
+ *   - timer NAME type=REAL running=1 interval=0.010000 value=0.004213 speed_factor=1.000000 expirations=N missed=N
+ *   - lateness NAME <1us=N <2us=N ... >=16384us=N (only ITIMER_REAL)
+ *   - queue NAME size=N
+ *
+ * The server does not create threads: pending connections are served by poll(), which is called by the user
+ * (e.g. periodically or if the socket returned by get_fd() is readable). Reports are sent without blocking.
+ * poll() reads the timer state and must therefore be called from the thread that controls the timers.
+ */
+class IntrospectionServer {
+private:
+    //* registered timer
+    struct TimerEntry {
+        std::string                 name;
+        std::unique_ptr<TimerStats> stats;
+    };
+
+    //* registered queue
+    struct QueueEntry {
+        std::string            name;
+        const QueueDispatcher &dispatcher;
+    };
+
+    //* socket path
+    std::string path;
+
+    //* device of the socket file
+    dev_t socket_dev {0};
+
+    //* inode of the socket file (removed only if the path still refers to it)
+    ino_t socket_ino {0};
+
+    //* listening socket (its initialization sets socket_dev and socket_ino)
+    int fd;
+
+    //* registered timers
+    std::vector<TimerEntry> timers;
+
+    //* registered queues
+    std::vector<QueueEntry> queues;
+
+public:
+    /**
+     * @brief create server
+     * @details an existing socket at path is replaced if no process is bound to it (stale socket of a previous server)
+     * @param path socket path
+     * @exception std::invalid_argument socket path too long
+     * @exception std::system_error path exists and is not a stale socket (EADDRINUSE) or call of socket, bind, stat or
+     *            listen failed
+     */
+    explicit IntrospectionServer(std::string path);
+
+    //* destroy server (removes the socket file if it was not replaced)
+    ~IntrospectionServer();
+
+    //* copying is not possible
+    IntrospectionServer(const IntrospectionServer &other) = delete;
+    //* moving is not possible
+    IntrospectionServer(IntrospectionServer &&other) = delete;
+    //* copying is not possible
+    IntrospectionServer &operator=(const IntrospectionServer &other) = delete;
+    //* moving is not possible
+    IntrospectionServer &operator=(IntrospectionServer &&other) = delete;
+
+    /**
+     * @brief register a timer
+     * @details attaches a TimerStats hook to the signal of the timer
+     * @param name name in the report (must not contain whitespace)
+     * @param timer timer (must outlive the server)
+     * @exception std::invalid_argument invalid name
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    void add_timer(const std::string &name, const ITimer &timer);
+
+    /**
+     * @brief register a queue
+     * @param name name in the report (must not contain whitespace)
+     * @param dispatcher queue dispatcher (must outlive the server)
+     * @exception std::invalid_argument invalid name
+     */
+    void add_queue(const std::string &name, const QueueDispatcher &dispatcher);
+
+    /**
+     * @brief serve all pending connections
+     * @return number of served clients
+     * @exception std::system_error call of accept failed
+     */
+    std::size_t poll();
+
+    /**
+     * @brief create the report that is sent to the clients
+     * @return report
+     */
+    [[nodiscard]] std::string report() const;
+
+    /**
+     * @brief get socket file descriptor
+     * @details becomes readable if a client connects (e.g. for poll/epoll)
+     * @return file descriptor
+     */
+    [[nodiscard]] inline int get_fd() const noexcept { return fd; }
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_queue_dispatcher.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief class LeaseManager
+ *
+ * @details
+ * Grants time bounded exclusive leases on named resources. Leases expire automatically on the timer queue of a
+ * QueueDispatcher.
+ *
+ * Extending a lease only updates its expiration time (O(1)). The timer of the lease is not changed. If the timer
+ * expires before the lease, it is scheduled again for the new expiration time.
+ * Shortening a lease reschedules its timer for the new expiration time.
+ *
+ * Expired leases are collected while the dispatcher executes the expired timers and are reported in one batch per tick
+ * by flush() (called by wait_and_dispatch()).
+ *
+ * All member functions except the constructor and the destructor can be called concurrently from any thread.
+ * The expiry callback may acquire, renew and release leases.
+ */
+class LeaseManager {
+public:
+    using time_point = QueueDispatcher::time_point;
+
+    //* identifies a lease
+    using lease_id = std::uint64_t;
+
+    //* identifies a lease holder
+    using holder_id = std::uint64_t;
+
+    //* lease
+    struct Lease {
+        //* lease id
+        lease_id id;
+
+        //* leased resource
+        std::string resource;
+
+        //* lease holder
+        holder_id holder;
+
+        //* expiration time (clock domain of the dispatcher)
+        time_point expires_at;
+    };
+
+    //* expiry callback (all leases that expired with one tick)
+    using expiry_callback_t = std::function<void(const std::vector<Lease> &)>;
+
+private:
+    //* active lease
+    struct Entry {
+        //* lease
+        Lease lease;
+
+        //* timer that checks the expiration
+        QueueDispatcher::timer_id timer;
+    };
+
+    //* timer queue
+    QueueDispatcher &dispatcher;
+
+    //* expiry callback
+    expiry_callback_t callback;
+
+    //* active leases
+    std::unordered_map<lease_id, Entry> leases;
+
+    //* active lease per resource
+    std::unordered_map<std::string, lease_id> resources;
+
+    //* expired leases that were not reported yet
+    std::vector<Lease> expired;
+
+    //* last assigned lease id
+    lease_id last_id = 0;
+
+    //* protects leases, resources and expired
+    mutable std::mutex mutex;
+
+public:
+    /**
+     * @brief create lease manager
+     * @param dispatcher timer queue
+     * @param callback expiry callback
+     */
+    LeaseManager(QueueDispatcher &dispatcher, expiry_callback_t callback);
+
+    //* destroy lease manager (cancels the timers of all leases)
+    ~LeaseManager();
+
+    //* copying is not possible
+    LeaseManager(const LeaseManager &other) = delete;
+    //* moving is not possible
+    LeaseManager(LeaseManager &&other) = delete;
+    //* copying is not possible
+    LeaseManager &operator=(const LeaseManager &other) = delete;
+    //* moving is not possible
+    LeaseManager &operator=(LeaseManager &&other) = delete;
+
+    /**
+     * @brief acquire lease
+     * @details if the holder already holds the lease of the resource, the lease is renewed
+     * @param resource resource
+     * @param holder lease holder
+     * @param duration lease duration (clock domain of the dispatcher)
+     * @return lease id (nothing if the resource is leased by another holder)
+     * @exception std::system_error call of setitimer failed
+     */
+    std::optional<lease_id> acquire(const std::string &resource, holder_id holder, std::chrono::nanoseconds duration);
+
+    /**
+     * @brief renew lease
+     * @param id lease id
+     * @param duration lease duration from now on
+     * @return true lease renewed
+     * @return false no such lease (expired or released)
+     * @exception std::system_error call of setitimer failed
+     */
+    bool renew(lease_id id, std::chrono::nanoseconds duration);
+
+    /**
+     * @brief release lease
+     * @param id lease id
+     * @return true lease released
+     * @return false no such lease (expired or released)
+     * @exception std::system_error call of setitimer failed
+     */
+    bool release(lease_id id);
+
+    /**
+     * @brief get active lease of a resource
+     * @param resource resource
+     * @return lease (nothing if the resource is not leased)
+     */
+    [[nodiscard]] std::optional<Lease> get_lease(const std::string &resource) const;
+
+    /**
+     * @brief get number of active leases
+     * @return number of active leases
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief report expired leases
+     * @details must be called after the dispatcher executed the expired timers if the dispatcher is driven directly
+     * @return number of reported leases
+     */
+    std::size_t flush();
+
+    /**
+     * @brief wait for the next expiration of the kernel timer, execute expired timers and report expired leases
+     * @return number of reported leases
+     * @exception std::system_error call of setitimer failed
+     */
+    std::size_t wait_and_dispatch();
+
+private:
+    //* schedule expiration timer of a lease (mutex must be locked)
+    void schedule(Entry &entry);
+
+    //* called by the timer of a lease
+    void on_timer(lease_id id);
+};
+
+}  // namespace cxxitimer
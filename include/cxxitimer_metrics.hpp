@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief class TimeSeries
+ *
+ * @details
+ * Compressed in-memory time series.
+ * Timestamps are stored as delta of delta, values as XOR with the previous value (Gorilla encoding).
+ * Regularly sampled slowly changing metrics require about 1-2 bytes per sample.
+ *
+ * Samples are stored in blocks of SAMPLES_PER_BLOCK samples.
+ * If a maximum number of samples is set, the oldest blocks are discarded.
+ */
+class TimeSeries {
+public:
+    //* timestamp (milliseconds since epoch)
+    using time_point = std::chrono::milliseconds;
+
+    //* number of samples per block
+    static constexpr std::size_t SAMPLES_PER_BLOCK = 128;
+
+    //* sample
+    struct Sample {
+        //* timestamp
+        time_point timestamp;
+
+        //* value
+        double value;
+    };
+
+private:
+    //* block of compressed samples
+    struct Block {
+        //* bit stream
+        std::vector<std::uint64_t> bits;
+
+        //* number of used bits
+        std::size_t bit_count = 0;
+
+        //* number of samples
+        std::size_t count = 0;
+
+        //* timestamp of the first sample
+        std::int64_t first_timestamp = 0;
+
+        //* timestamp of the last sample
+        std::int64_t last_timestamp = 0;
+
+        //* last timestamp delta
+        std::int64_t last_delta = 0;
+
+        //* bit pattern of the last value
+        std::uint64_t last_value = 0;
+
+        //* leading zeros of the last stored XOR
+        unsigned leading = 0;
+
+        //* trailing zeros of the last stored XOR (64: no XOR stored yet)
+        unsigned trailing = 64;
+
+        //* append bits
+        void write(std::uint64_t value, unsigned nbits);
+    };
+
+    //* blocks (oldest first)
+    std::deque<Block> blocks;
+
+    //* maximum number of samples (0: unlimited)
+    std::size_t max_samples;
+
+    //* number of samples
+    std::size_t sample_count = 0;
+
+public:
+    /**
+     * @brief create time series
+     * @param max_samples maximum number of samples (0: unlimited)
+     */
+    explicit TimeSeries(std::size_t max_samples = 0) noexcept : max_samples(max_samples) {}
+
+    /**
+     * @brief append sample
+     * @param timestamp timestamp (must not be older than the last sample)
+     * @param value value
+     * @exception std::invalid_argument timestamp older than the last sample
+     */
+    void append(time_point timestamp, double value);
+
+    /**
+     * @brief get samples in range
+     * @param from first timestamp (inclusive)
+     * @param to last timestamp (inclusive)
+     * @return samples (oldest first)
+     */
+    [[nodiscard]] std::vector<Sample> query(time_point from, time_point to) const;
+
+    /**
+     * @brief get number of samples
+     * @return number of samples
+     */
+    [[nodiscard]] inline std::size_t size() const noexcept { return sample_count; }
+
+    /**
+     * @brief get size of the compressed data
+     * @return size in bytes
+     */
+    [[nodiscard]] std::size_t get_compressed_size() const noexcept;
+};
+
+/**
+ * @brief class MetricSampler
+ *
+ * @details
+ * Samples registered counters and gauges on each expiration of a timer and appends them to compressed time series.
+ *
+ * Sampling is performed by the thread that calls wait_and_sample() (not in signal context). Therefore, gauge callbacks
+ * may perform arbitrary operations.
+ * Queries are thread safe.
+ */
+class MetricSampler {
+public:
+    //* gauge callback
+    using gauge_t = std::function<double()>;
+
+    //* timestamp (milliseconds since epoch)
+    using time_point = TimeSeries::time_point;
+
+private:
+    //* registered metric
+    struct Metric {
+        //* metric name
+        std::string name;
+
+        //* reads the metric
+        gauge_t read;
+
+        //* recorded samples
+        TimeSeries series;
+    };
+
+    //* registered metrics
+    std::deque<Metric> metrics;
+
+    //* maximum number of samples per metric
+    std::size_t max_samples;
+
+    //* timestamp of the last samples
+    time_point last_timestamp {0};
+
+    //* protects metrics
+    mutable std::mutex mutex;
+
+    //* notifies about expirations of the timer
+    TickBroadcast broadcast;
+
+    //* last processed tick sequence number
+    std::uint32_t sequence;
+
+public:
+    /**
+     * @brief create sampler
+     * @param timer timer that drives the sampler
+     * @param max_samples maximum number of samples per metric (0: unlimited)
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit MetricSampler(const ITimer &timer, std::size_t max_samples = 0);
+
+    //* destroy sampler
+    ~MetricSampler();
+
+    //* copying is not possible
+    MetricSampler(const MetricSampler &other) = delete;
+    //* moving is not possible
+    MetricSampler(MetricSampler &&other) = delete;
+    //* copying is not possible
+    MetricSampler &operator=(const MetricSampler &other) = delete;
+    //* moving is not possible
+    MetricSampler &operator=(MetricSampler &&other) = delete;
+
+    /**
+     * @brief add counter
+     * @details the counter must outlive the sampler. Values above 2^53 lose precision.
+     * @param name metric name
+     * @param counter counter
+     * @exception std::invalid_argument metric with the same name already exists
+     */
+    void add_counter(const std::string &name, const std::atomic<std::uint64_t> &counter);
+
+    /**
+     * @brief add gauge
+     * @details the gauge must outlive the sampler
+     * @param name metric name
+     * @param gauge gauge
+     * @exception std::invalid_argument metric with the same name already exists
+     */
+    void add_gauge(const std::string &name, const std::atomic<double> &gauge);
+
+    /**
+     * @brief add gauge
+     * @param name metric name
+     * @param gauge function that reads the gauge
+     * @exception std::invalid_argument metric with the same name already exists
+     */
+    void add_gauge(const std::string &name, gauge_t gauge);
+
+    /**
+     * @brief sample all metrics
+     * @details gauge callbacks must not call methods of the sampler
+     * @param timestamp timestamp of the samples
+     * @exception std::invalid_argument timestamp older than the last samples
+     */
+    void sample(time_point timestamp);
+
+    /**
+     * @brief sample all metrics
+     * @details timestamp: current system time (not older than the last samples)
+     */
+    void sample();
+
+    /**
+     * @brief wait for the next expiration and sample all metrics
+     */
+    void wait_and_sample();
+
+    /**
+     * @brief get samples of a metric in range
+     * @param name metric name
+     * @param from first timestamp (inclusive)
+     * @param to last timestamp (inclusive)
+     * @return samples (oldest first)
+     * @exception std::out_of_range no such metric
+     */
+    [[nodiscard]] std::vector<TimeSeries::Sample> query(const std::string &name, time_point from, time_point to) const;
+
+    /**
+     * @brief get names of all metrics
+     * @return metric names
+     */
+    [[nodiscard]] std::vector<std::string> get_names() const;
+
+    /**
+     * @brief get size of the compressed data of all metrics
+     * @return size in bytes
+     */
+    [[nodiscard]] std::size_t get_compressed_size() const noexcept;
+
+private:
+    //* add metric
+    void add_metric(const std::string &name, gauge_t read);
+
+    //* sample all metrics (mutex must be locked)
+    void append_samples(time_point timestamp);
+};
+
+}  // namespace cxxitimer
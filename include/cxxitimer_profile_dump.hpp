@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_profiler.hpp"
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief raw profile dump
+ *
+ * @details
+ * Contains the samples with raw addresses, the labels used by the samples and a snapshot of /proc/self/maps taken at
+ * dump time. The addresses are symbolized offline (tool cxxitimer_symbolize).
+ */
+struct ProfileDump {
+    //* content of /proc/self/maps at dump time
+    std::string maps;
+
+    //* samples
+    std::vector<ProfileSample> samples;
+
+    //* key and value of all labels used by the samples
+    std::map<label_id, std::pair<std::string, std::string>> labels;
+};
+
+/**
+ * @brief write samples and a snapshot of /proc/self/maps
+ * @param out output stream (binary)
+ * @param samples samples
+ * @exception std::system_error failed to read /proc/self/maps
+ * @exception std::runtime_error failed to write the dump
+ */
+void write_profile_dump(std::ostream &out, const std::vector<ProfileSample> &samples);
+
+/**
+ * @brief read a profile dump
+ * @param in input stream (binary)
+ * @return profile dump
+ * @exception std::runtime_error invalid dump
+ */
+ProfileDump read_profile_dump(std::istream &in);
+
+}  // namespace cxxitimer
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_profiler.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace cxxitimer {
+
+//* identifies a call stack (hash of the stack frames)
+using stack_id = std::uint64_t;
+
+/**
+ * @brief class ProfileWindows
+ *
+ * @details
+ * Aggregates profile samples into windows of fixed length (e.g. 60 s) and keeps the last N windows in memory.
+ * Each window stores the CPU time per call stack. Call stacks are identified by a hash of their frames (the next free
+ * id on hash collisions). The frames of each stack are stored once and are removed when the last window that contains
+ * the stack is discarded.
+ *
+ * Windows are assigned by the timestamps of the samples (CLOCK_MONOTONIC).
+ * diff() compares the CPU time distribution of two windows.
+ *
+ * The class is not thread safe.
+ */
+class ProfileWindows {
+public:
+    //* profile of one window
+    struct Window {
+        //* start of the window (CLOCK_MONOTONIC, nsec)
+        std::int64_t start;
+
+        //* CPU time (nsec) per call stack
+        std::unordered_map<stack_id, std::int64_t> cpu_time;
+
+        //* total CPU time (nsec)
+        std::int64_t total = 0;
+    };
+
+    //* difference of one call stack between two windows
+    struct DiffEntry {
+        //* call stack
+        stack_id stack;
+
+        //* CPU time in the base window (seconds)
+        double base_cpu;
+
+        //* CPU time in the compared window (seconds)
+        double cpu;
+
+        //* change of the fraction of the total CPU time (compared - base)
+        double delta;
+    };
+
+private:
+    //* hash of the frames of a call stack
+    struct FramesHash {
+        std::size_t operator()(const std::vector<void *> &frames) const noexcept {
+            return hash_stack(frames.data(), frames.size());
+        }
+    };
+
+    //* call stack ids by frames (innermost first)
+    using stack_index_t = std::unordered_map<std::vector<void *>, stack_id, FramesHash>;
+
+    //* stored call stack
+    struct Stack {
+        //* entry of the stack in the index (frames)
+        stack_index_t::iterator entry;
+
+        //* number of windows that contain the stack
+        std::size_t references;
+    };
+
+    //* window length (nsec)
+    std::int64_t length;
+
+    //* maximum number of windows
+    std::size_t max_windows;
+
+    //* windows (oldest first)
+    std::deque<Window> windows;
+
+    //* call stacks
+    std::unordered_map<stack_id, Stack> stacks;
+
+    //* ids of the stored call stacks
+    stack_index_t stack_index;
+
+public:
+    /**
+     * @brief create window store
+     * @param length window length
+     * @param max_windows maximum number of windows (including the current window)
+     * @exception std::invalid_argument length not positive or max_windows is 0
+     */
+    ProfileWindows(std::chrono::nanoseconds length, std::size_t max_windows);
+
+    /**
+     * @brief add sample
+     * @details samples older than the current window are added to the current window
+     * @param sample sample
+     */
+    void add(const ProfileSample &sample);
+
+    /**
+     * @brief add samples
+     * @param samples samples
+     */
+    void add(const std::vector<ProfileSample> &samples);
+
+    /**
+     * @brief start all windows up to the one that contains a time (e.g. to close windows without samples)
+     * @param now current time (CLOCK_MONOTONIC, nsec)
+     */
+    void rotate(std::int64_t now);
+
+    /**
+     * @brief get number of windows
+     * @return number of windows
+     */
+    [[nodiscard]] inline std::size_t size() const noexcept { return windows.size(); }
+
+    /**
+     * @brief get window
+     * @param age age of the window (0: current window, 1: previous window, ...)
+     * @return window
+     * @exception std::out_of_range no such window
+     */
+    [[nodiscard]] const Window &get_window(std::size_t age) const;
+
+    /**
+     * @brief get frames of a call stack
+     * @param id call stack
+     * @return frames (innermost first)
+     * @exception std::out_of_range unknown call stack
+     */
+    [[nodiscard]] const std::vector<void *> &get_stack(stack_id id) const;
+
+    /**
+     * @brief compare two windows
+     * @details
+     * The CPU time of each stack is normalized by the total CPU time of its window. Therefore, windows with different
+     * load can be compared.
+     * @param base_age age of the base window (e.g. 10: ten windows ago)
+     * @param age age of the compared window (e.g. 0: current window)
+     * @return differences of all stacks that occur in one of the windows (largest absolute delta first)
+     * @exception std::out_of_range no such window
+     */
+    [[nodiscard]] std::vector<DiffEntry> diff(std::size_t base_age, std::size_t age) const;
+
+    /**
+     * @brief calculate the id of a call stack
+     * @param frames stack frames
+     * @param depth number of stack frames
+     * @return call stack id
+     */
+    [[nodiscard]] static stack_id hash_stack(void *const *frames, std::size_t depth) noexcept;
+
+private:
+    //* store a call stack and get its id (considers hash collisions)
+    stack_id intern_stack(const ProfileSample &sample);
+
+    //* start a new window (discards the oldest window if necessary)
+    void push_window(std::int64_t start);
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+namespace cxxitimer {
+
+//* identifies an interned label (key/value pair)
+using label_id = std::uint32_t;
+
+/**
+ * @brief sample recorded by the Profiler
+ */
+struct ProfileSample {
+    //* maximum number of stack frames per sample
+    static constexpr std::size_t MAX_DEPTH = 32;
+
+    //* maximum number of labels per sample
+    static constexpr std::size_t MAX_LABELS = 8;
+
+    //* time of the sample (CLOCK_MONOTONIC, nsec)
+    std::int64_t timestamp;
+
+    //* CPU time represented by the sample (nsec)
+    std::int64_t period;
+
+    //* id of the sampled thread
+    pid_t thread;
+
+    //* number of stack frames
+    std::uint32_t depth;
+
+    //* number of labels
+    std::uint32_t label_count;
+
+    //* stack frames (innermost first, stack[0]: interrupted instruction)
+    void *stack[MAX_DEPTH];
+
+    //* labels of the sampled thread (outermost first)
+    label_id labels[MAX_LABELS];
+};
+
+/**
+ * @brief class Profiler
+ *
+ * @details
+ * Sampling CPU profiler that records a sample on each expiration of an ITimer_Prof (SIGPROF).
+ *
+ * The signal handler captures the interrupted instruction, the call stack (raw addresses) and the labels of the
+ * interrupted thread and stores them in a lock-free ring buffer. Samples are removed from the ring buffer with read().
+ * If the ring buffer is full, samples are dropped.
+ *
+ * The call stack is captured with backtrace(), which is not async-signal-safe: the unwinder takes the lock of the
+ * dynamic linker. A sample that interrupts dlopen()/dlclose() or the unwinding of a thrown exception may deadlock.
+ * Shared libraries must not be loaded or unloaded and exceptions must not be thrown while the profiler is attached.
+ *
+ * Labels (e.g. tenant=42, stage=parse) are set with ScopedLabel. They are kept in a thread local stack that can be
+ * accessed from the signal handler without locking.
+ *
+ * read() must not be called concurrently.
+ */
+class Profiler : public TickHook {
+private:
+    //* entry of the ring buffer
+    struct Slot {
+        //* sequence number of the slot
+        std::atomic<std::uint64_t> sequence;
+
+        //* sample
+        ProfileSample sample;
+    };
+
+    //* ring buffer
+    std::unique_ptr<Slot[]> slots;
+
+    //* capacity - 1 (capacity is a power of 2)
+    std::size_t mask;
+
+    //* write position
+    alignas(64) std::atomic<std::uint64_t> head {0};
+
+    //* read position
+    alignas(64) std::uint64_t tail = 0;
+
+    //* number of dropped samples
+    std::atomic<std::uint64_t> dropped {0};
+
+    //* CPU time represented by a sample (nsec)
+    std::atomic<std::int64_t> period;
+
+    //* accumulated execution time of record() (nsec)
+    std::atomic<std::int64_t> handler_time {0};
+
+    //* number of executions of record()
+    std::atomic<std::uint64_t> invocations {0};
+
+public:
+    /**
+     * @brief create profiler
+     * @details the profiler is attached to the signal of the timer. The timer is not started.
+     * @param timer profiling timer
+     * @param capacity capacity of the ring buffer (rounded up to a power of 2)
+     * @exception std::invalid_argument capacity is 0
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit Profiler(const ITimer_Prof &timer, std::size_t capacity = 4096);
+
+    //* destroy profiler
+    ~Profiler() override;
+
+    //* copying is not possible
+    Profiler(const Profiler &other) = delete;
+    //* moving is not possible
+    Profiler(Profiler &&other) = delete;
+    //* copying is not possible
+    Profiler &operator=(const Profiler &other) = delete;
+    //* moving is not possible
+    Profiler &operator=(Profiler &&other) = delete;
+
+    /**
+     * @brief remove all recorded samples from the ring buffer
+     * @param samples samples are appended to this vector
+     * @return number of removed samples
+     */
+    std::size_t read(std::vector<ProfileSample> &samples);
+
+    /**
+     * @brief get number of samples that were dropped because the ring buffer was full
+     * @return number of dropped samples
+     */
+    [[nodiscard]] inline std::uint64_t get_dropped() const noexcept { return dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief get accumulated execution time of the sample handler
+     * @details measured with the TscClock. Does not include the signal delivery by the kernel.
+     * @return execution time (nsec)
+     */
+    [[nodiscard]] inline std::int64_t get_handler_time() const noexcept {
+        return handler_time.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief get number of executions of the sample handler (including dropped samples)
+     * @return number of executions
+     */
+    [[nodiscard]] inline std::uint64_t get_invocations() const noexcept {
+        return invocations.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief set CPU time represented by a sample
+     * @details must be called if interval or speed factor of the timer are changed
+     * @param timer profiling timer
+     */
+    void update_period(const ITimer &timer) noexcept;
+
+    /**
+     * @brief get CPU time represented by a sample
+     * @return CPU time (nsec)
+     */
+    [[nodiscard]] inline std::int64_t get_period() const noexcept { return period.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief record a sample
+     * @details async-signal-safe
+     * @param context signal context (ucontext_t *, nullptr: no interrupted instruction available)
+     */
+    void record(void *context) noexcept;
+
+    //* internal use only!
+    inline void on_tick(void *context) noexcept override { record(context); }
+
+    /**
+     * @brief intern a label
+     * @param key label key
+     * @param value label value
+     * @return label id
+     */
+    static label_id intern_label(std::string_view key, std::string_view value);
+
+    /**
+     * @brief get key and value of an interned label
+     * @param id label id
+     * @return key and value
+     * @exception std::out_of_range unknown label
+     */
+    static std::pair<std::string, std::string> get_label(label_id id);
+
+private:
+    //* capture a sample and store it in the ring buffer
+    void store_sample(void *context) noexcept;
+};
+
+/**
+ * @brief class ScopedLabel
+ *
+ * @details
+ * Pushes a label on the label stack of the calling thread for the lifetime of the object.
+ * Only the outermost ProfileSample::MAX_LABELS labels are recorded.
+ *
+ * Interning a label requires a lookup in a global table. On hot paths, the label should be interned once
+ * (Profiler::intern_label) and the id should be passed to the constructor.
+ */
+class ScopedLabel {
+public:
+    /**
+     * @brief push label
+     * @param key label key
+     * @param value label value
+     */
+    ScopedLabel(std::string_view key, std::string_view value);
+
+    /**
+     * @brief push interned label
+     * @param id label id
+     */
+    explicit ScopedLabel(label_id id) noexcept;
+
+    //* pop label
+    ~ScopedLabel();
+
+    //* copying is not possible
+    ScopedLabel(const ScopedLabel &other) = delete;
+    //* moving is not possible
+    ScopedLabel(ScopedLabel &&other) = delete;
+    //* copying is not possible
+    ScopedLabel &operator=(const ScopedLabel &other) = delete;
+    //* moving is not possible
+    ScopedLabel &operator=(ScopedLabel &&other) = delete;
+};
+
+/**
+ * @brief class LabelProfile
+ *
+ * @details
+ * Aggregates the CPU time of profile samples by label.
+ */
+class LabelProfile {
+private:
+    //* CPU time (nsec) per label set
+    std::map<std::vector<label_id>, std::int64_t> cpu_time;
+
+public:
+    /**
+     * @brief add sample
+     * @param sample sample
+     */
+    void add(const ProfileSample &sample);
+
+    /**
+     * @brief add samples
+     * @param samples samples
+     */
+    void add(const std::vector<ProfileSample> &samples);
+
+    /**
+     * @brief get CPU time per value of a label key
+     * @details if a sample has several labels with the key, the innermost label is used
+     * @param key label key
+     * @return CPU time (seconds) per label value (empty value: samples without the key)
+     */
+    [[nodiscard]] std::map<std::string, double> get_cpu_by(std::string_view key) const;
+
+    /**
+     * @brief get total CPU time
+     * @return CPU time (seconds)
+     */
+    [[nodiscard]] double get_total_cpu() const noexcept;
+
+    //* remove all samples
+    inline void clear() noexcept { cpu_time.clear(); }
+};
+
+}  // namespace cxxitimer
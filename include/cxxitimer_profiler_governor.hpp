@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_profiler.hpp"
+
+#include <cstdint>
+
+namespace cxxitimer {
+
+/**
+ * @brief class ProfilerGovernor
+ *
+ * @details
+ * Keeps the overhead of a Profiler within a budget (fraction of the CPU time of the process).
+ *
+ * On each call of update(), the cost of the sample handler since the last update is related to the CPU time that was
+ * consumed by the process in the same period. The sampling interval is adjusted (via the speed factor of the timer)
+ * so that the overhead is below the budget:
+ *   - overhead above the target  -->  interval lengthened immediately
+ *   - overhead below the target  -->  interval shortened by at most max_increase per update
+ *
+ * The cost of a sample is the measured execution time of the sample handler plus an estimated constant for the signal
+ * delivery by the kernel (signal_cost).
+ *
+ * update() should be called periodically (e.g. each time the samples are read). It is not thread safe.
+ */
+class ProfilerGovernor {
+public:
+    //* governor parameters
+    struct Parameters {
+        //* maximum fraction of the CPU time used for profiling
+        double budget = 0.01;
+
+        //* fraction of the budget that is targeted (headroom for load changes)
+        double target = 0.8;
+
+        //* minimum sampling interval (CPU time, seconds)
+        double min_interval = 0.001;
+
+        //* maximum sampling interval (CPU time, seconds)
+        double max_interval = 1.0;
+
+        //* estimated cost of the signal delivery per sample (seconds)
+        double signal_cost = 2e-6;
+
+        //* maximum factor by which the sampling rate is increased per update
+        double max_increase = 1.25;
+    };
+
+private:
+    //* profiling timer
+    ITimer_Prof &timer;
+
+    //* governed profiler
+    Profiler &profiler;
+
+    //* governor parameters
+    Parameters parameters;
+
+    //* process CPU time at the last update (nsec)
+    std::int64_t last_cpu_time;
+
+    //* handler time at the last update (nsec)
+    std::int64_t last_handler_time;
+
+    //* handler invocations at the last update
+    std::uint64_t last_invocations;
+
+    //* overhead measured by the last update
+    double overhead = 0.0;
+
+public:
+    /**
+     * @brief create governor
+     * @param timer profiling timer (interval must be positive)
+     * @param profiler profiler that is attached to the timer
+     * @param parameters governor parameters
+     * @exception std::invalid_argument invalid parameters
+     */
+    ProfilerGovernor(ITimer_Prof &timer, Profiler &profiler, const Parameters &parameters);
+
+    /**
+     * @brief measure the overhead and adjust the sampling interval
+     * @return overhead since the last update (fraction of the CPU time)
+     * @exception std::system_error call of setitimer failed
+     */
+    double update();
+
+    /**
+     * @brief get overhead measured by the last update
+     * @return overhead (fraction of the CPU time)
+     */
+    [[nodiscard]] inline double get_overhead() const noexcept { return overhead; }
+
+    /**
+     * @brief get effective sampling interval
+     * @return interval / speed factor (CPU time, seconds)
+     */
+    [[nodiscard]] double get_interval() const noexcept;
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace cxxitimer {
+
+/**
+ * @brief abstract class TimerQueue
+ *
+ * @details
+ * Queue of logical timers (deadline + callback) that are multiplexed over one kernel timer (see QueueDispatcher).
+ * Deadlines are given as time since the epoch of the clock domain of the kernel timer.
+ *
+ * Queues are not thread safe. QueueDispatcher serializes all accesses.
+ */
+class TimerQueue {
+public:
+    //* time since the epoch of the clock domain
+    using time_point = std::chrono::nanoseconds;
+
+    //* callback that is executed when the deadline is reached
+    using callback_t = std::function<void()>;
+
+    //* identifies a scheduled timer
+    using timer_id = std::uint64_t;
+
+    //* id that is never assigned to a timer
+    static constexpr timer_id INVALID_ID = 0;
+
+    TimerQueue() noexcept = default;
+
+    //* destroy queue
+    virtual ~TimerQueue() = default;
+
+    //! copying is not possible
+    TimerQueue(const TimerQueue &other) = delete;
+    //! moving is not possible
+    TimerQueue(TimerQueue &&other) = delete;
+    //! copying is not possible
+    TimerQueue &operator=(const TimerQueue &other) = delete;
+    //! moving is not possible
+    TimerQueue &operator=(TimerQueue &&other) = delete;
+
+    /**
+     * @brief schedule timer
+     * @param deadline deadline
+     * @param callback callback
+     * @return timer id
+     */
+    virtual timer_id schedule(time_point deadline, callback_t callback) = 0;
+
+    /**
+     * @brief cancel timer
+     * @param id timer id
+     * @return true timer canceled
+     * @return false no such timer (already expired or canceled)
+     */
+    virtual bool cancel(timer_id id) = 0;
+
+    /**
+     * @brief change deadline of a timer
+     * @param id timer id
+     * @param deadline new deadline
+     * @return true deadline changed
+     * @return false no such timer (already expired or canceled)
+     */
+    virtual bool reschedule(timer_id id, time_point deadline) = 0;
+
+    /**
+     * @brief get earliest deadline
+     * @return earliest deadline or std::nullopt if the queue is empty
+     */
+    [[nodiscard]] virtual std::optional<time_point> next_deadline() = 0;
+
+    /**
+     * @brief remove all expired timers
+     * @param now current time
+     * @param expired callbacks of the expired timers are appended in deadline order
+     * @return number of expired timers
+     */
+    virtual std::size_t pop_expired(time_point now, std::vector<callback_t> &expired) = 0;
+
+    /**
+     * @brief get number of scheduled timers
+     * @return number of scheduled timers
+     */
+    [[nodiscard]] virtual std::size_t size() const noexcept = 0;
+
+    /**
+     * @brief check if queue is empty
+     * @return true no timer scheduled
+     * @return false at least one timer scheduled
+     */
+    [[nodiscard]] inline bool empty() const noexcept { return size() == 0; }
+};
+
+/**
+ * @brief class OrderedTimerQueue
+ *
+ * @details timer queue based on an ordered tree. O(log n) schedule, cancel and reschedule.
+ */
+class OrderedTimerQueue : public TimerQueue {
+private:
+    //* scheduled timer
+    struct Entry {
+        timer_id   id;
+        callback_t callback;
+    };
+
+    //* timers ordered by deadline
+    std::multimap<time_point, Entry> timers;
+
+    //* position of the timers in the tree
+    std::unordered_map<timer_id, std::multimap<time_point, Entry>::iterator> index;
+
+    //* last assigned timer id
+    timer_id last_id = INVALID_ID;
+
+public:
+    OrderedTimerQueue() = default;
+
+    //* destroy queue
+    ~OrderedTimerQueue() override;
+
+    //* copying is not possible
+    OrderedTimerQueue(const OrderedTimerQueue &other) = delete;
+    //* moving is not possible
+    OrderedTimerQueue(OrderedTimerQueue &&other) = delete;
+    //* copying is not possible
+    OrderedTimerQueue &operator=(const OrderedTimerQueue &other) = delete;
+    //* moving is not possible
+    OrderedTimerQueue &operator=(OrderedTimerQueue &&other) = delete;
+
+    timer_id                                schedule(time_point deadline, callback_t callback) override;
+    bool                                    cancel(timer_id id) override;
+    bool                                    reschedule(timer_id id, time_point deadline) override;
+    [[nodiscard]] std::optional<time_point> next_deadline() override;
+    std::size_t                             pop_expired(time_point now, std::vector<callback_t> &expired) override;
+    [[nodiscard]] std::size_t               size() const noexcept override;
+};
+
+/**
+ * @brief class HeapTimerQueue
+ *
+ * @details
+ * Timer queue based on a 4-ary min heap. Timers expire in exact deadline order (no rounding to slots).
+ *
+ *   - schedule, reschedule: O(log n) (each node tracks its heap position)
+ *   - cancel: O(1) (lazy: the node is marked as tombstone and removed when it reaches the top of the heap
+ *     or when tombstones make up the majority of the heap)
+ */
+class HeapTimerQueue : public TimerQueue {
+private:
+    //* heap node
+    struct Node {
+        time_point  deadline;
+        timer_id    id;
+        callback_t  callback;
+        std::size_t heap_pos;
+        bool        tombstone;
+    };
+
+    //* number of children per heap node
+    static constexpr std::size_t ARITY = 4;
+
+    //* node storage (indices are stable)
+    std::vector<Node> nodes;
+
+    //* unused node indices
+    std::vector<std::size_t> free_nodes;
+
+    //* heap of node indices
+    std::vector<std::size_t> heap;
+
+    //* node index of the scheduled timers
+    std::unordered_map<timer_id, std::size_t> index;
+
+    //* number of tombstones in the heap
+    std::size_t tombstones = 0;
+
+    //* last assigned timer id
+    timer_id last_id = INVALID_ID;
+
+public:
+    HeapTimerQueue() = default;
+
+    //* destroy queue
+    ~HeapTimerQueue() override;
+
+    //* copying is not possible
+    HeapTimerQueue(const HeapTimerQueue &other) = delete;
+    //* moving is not possible
+    HeapTimerQueue(HeapTimerQueue &&other) = delete;
+    //* copying is not possible
+    HeapTimerQueue &operator=(const HeapTimerQueue &other) = delete;
+    //* moving is not possible
+    HeapTimerQueue &operator=(HeapTimerQueue &&other) = delete;
+
+    timer_id                                schedule(time_point deadline, callback_t callback) override;
+    bool                                    cancel(timer_id id) override;
+    bool                                    reschedule(timer_id id, time_point deadline) override;
+    [[nodiscard]] std::optional<time_point> next_deadline() override;
+    std::size_t                             pop_expired(time_point now, std::vector<callback_t> &expired) override;
+    [[nodiscard]] std::size_t               size() const noexcept override;
+
+private:
+    //* move heap element up until the heap property is restored
+    void sift_up(std::size_t pos) noexcept;
+
+    //* move heap element down until the heap property is restored
+    void sift_down(std::size_t pos) noexcept;
+
+    //* remove the top element of the heap and release its node
+    void pop_top() noexcept;
+
+    //* remove tombstones from the top of the heap
+    void purge_top() noexcept;
+
+    //* remove all tombstones and rebuild the heap
+    void compact();
+
+    //* place node at heap position
+    inline void place(std::size_t pos, std::size_t node) noexcept {
+        heap[pos]            = node;
+        nodes[node].heap_pos = pos;
+    }
+};
+
+}  // namespace cxxitimer
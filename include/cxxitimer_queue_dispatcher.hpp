@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_queue.hpp"
+#include "cxxitimer_tick.hpp"
+
+#include <mutex>
+
+namespace cxxitimer {
+
+/**
+ * @brief class QueueDispatcher
+ *
+ * @details
+ * Multiplexes the logical timers of a TimerQueue over one kernel timer.
+ * The kernel timer is armed for the earliest deadline of the queue. The dispatcher takes over the control of the timer
+ * (the timer must not be started, stopped or changed otherwise while the dispatcher exists).
+ *
+ * The clock domain of the deadlines depends on the timer type:
+ *   - ITimer_Real     -->  CLOCK_MONOTONIC
+ *   - ITimer_Virtual  -->  user CPU time of the process
+ *   - ITimer_Prof     -->  total (user + system) CPU time of the process
+ *
+ * Callbacks are executed by the thread that calls dispatch() or wait_and_dispatch(), never in signal context.
+ * All other member functions can be called concurrently from any thread (but not from signal handlers).
+ * Callbacks may schedule or cancel timers.
+ */
+class QueueDispatcher {
+public:
+    using time_point = TimerQueue::time_point;
+    using callback_t = TimerQueue::callback_t;
+    using timer_id   = TimerQueue::timer_id;
+
+private:
+    //* kernel timer
+    ITimer &timer;
+
+    //* logical timers
+    TimerQueue &queue;
+
+    //* notifies about expirations of the kernel timer
+    TickBroadcast broadcast;
+
+    //* last tick sequence number processed by wait_and_dispatch
+    std::uint32_t sequence;
+
+    //* deadline the kernel timer is armed for
+    std::optional<time_point> armed_deadline;
+
+    //* serializes access to queue and timer
+    mutable std::mutex mutex;
+
+public:
+    /**
+     * @brief create dispatcher
+     * @param timer kernel timer (must be stopped)
+     * @param queue logical timers
+     * @exception std::logic_error timer is running
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    QueueDispatcher(ITimer &timer, TimerQueue &queue);
+
+    //* destroy dispatcher (stops the kernel timer)
+    ~QueueDispatcher();
+
+    //* copying is not possible
+    QueueDispatcher(const QueueDispatcher &other) = delete;
+    //* moving is not possible
+    QueueDispatcher(QueueDispatcher &&other) = delete;
+    //* copying is not possible
+    QueueDispatcher &operator=(const QueueDispatcher &other) = delete;
+    //* moving is not possible
+    QueueDispatcher &operator=(QueueDispatcher &&other) = delete;
+
+    /**
+     * @brief get current time in the clock domain of the kernel timer
+     * @return current time
+     */
+    [[nodiscard]] time_point now() const noexcept;
+
+    /**
+     * @brief get current time in the clock domain of a timer type
+     * @param type timer type (ITIMER_REAL/ITIMER_VIRTUAL/ITIMER_PROF)
+     * @return current time
+     */
+    [[nodiscard]] static time_point now(int type) noexcept;
+
+    /**
+     * @brief schedule timer at a deadline
+     * @param deadline deadline
+     * @param callback callback
+     * @return timer id
+     * @exception std::system_error call of setitimer failed
+     */
+    timer_id schedule_at(time_point deadline, callback_t callback);
+
+    /**
+     * @brief schedule timer after a delay
+     * @param delay delay (in the clock domain of the kernel timer)
+     * @param callback callback
+     * @return timer id
+     * @exception std::system_error call of setitimer failed
+     */
+    timer_id schedule_after(std::chrono::nanoseconds delay, callback_t callback);
+
+    /**
+     * @brief cancel timer
+     * @param id timer id
+     * @return true timer canceled
+     * @return false no such timer
+     * @exception std::system_error call of setitimer failed
+     */
+    bool cancel(timer_id id);
+
+    /**
+     * @brief change deadline of a timer
+     * @param id timer id
+     * @param deadline new deadline
+     * @return true deadline changed
+     * @return false no such timer
+     * @exception std::system_error call of setitimer failed
+     */
+    bool reschedule(timer_id id, time_point deadline);
+
+    /**
+     * @brief execute the callbacks of all expired timers
+     * @return number of executed callbacks
+     * @exception std::system_error call of setitimer failed
+     */
+    std::size_t dispatch();
+
+    /**
+     * @brief wait for the next expiration of the kernel timer and execute the callbacks of all expired timers
+     * @return number of executed callbacks
+     * @exception std::system_error call of setitimer failed
+     */
+    std::size_t wait_and_dispatch();
+
+    /**
+     * @brief wait for the next expiration of the kernel timer (at most timeout) and execute expired callbacks
+     * @param timeout maximum time to wait
+     * @return number of executed callbacks
+     * @exception std::system_error call of setitimer failed
+     */
+    std::size_t wait_and_dispatch(const timeval &timeout);
+
+    /**
+     * @brief get number of scheduled timers
+     * @return number of scheduled timers
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief get kernel timer
+     * @return kernel timer
+     */
+    [[nodiscard]] inline const ITimer &get_timer() const noexcept { return timer; }
+
+private:
+    //* arm the kernel timer for the earliest deadline (mutex must be locked)
+    void rearm();
+};
+
+}  // namespace cxxitimer
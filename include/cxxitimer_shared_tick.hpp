@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+
+namespace cxxitimer {
+
+class SharedMemory;
+struct SharedTickPage;
+
+//* consistent snapshot of the data published by a SharedTickSource
+struct SharedTickSnapshot {
+    //* number of expirations since the source was created
+    std::uint64_t ticks;
+
+    //* CLOCK_REALTIME at the last expiration (nsec)
+    std::int64_t realtime_nsec;
+
+    //* CLOCK_MONOTONIC at the last expiration (nsec)
+    std::int64_t monotonic_nsec;
+
+    //* speed factor of the timer that drives the source
+    double speed_factor;
+};
+
+/**
+ * @brief class SharedTickSource
+ *
+ * @details
+ * Publishes the tick count, a coarse time and the speed factor of a timer in a shared memory page.
+ * The speed factor is read from the timer on each tick (changes of the timer are published with the next tick).
+ * Other processes can map the page read only (SharedTickReader) instead of arming their own timers.
+ * The page is protected by a seqlock. Each tick wakes all processes that wait for a tick (one futex wake).
+ *
+ * The shared memory object is removed when the source is destroyed.
+ */
+class SharedTickSource : public TickHook {
+private:
+    //* timer that drives the source
+    ITimer &timer;
+
+    //* shared memory object
+    std::unique_ptr<SharedMemory> shm;
+
+    //* mapped page
+    SharedTickPage *page;
+
+public:
+    /**
+     * @brief create shared memory page and attach to the signal of the timer
+     * @param timer timer that drives the source
+     * @param name name of the shared memory object (see man shm_open)
+     * @param mode permissions of the shared memory object
+     * @exception std::system_error failed to create shared memory object (EEXIST: object already exists) or call of
+     *            sigaction failed
+     * @exception std::runtime_error too many hooks attached to the signal
+     */
+    SharedTickSource(ITimer &timer, const std::string &name, mode_t mode = 0644);
+
+    //* destroy instance (removes the shared memory object)
+    ~SharedTickSource() override;
+
+    //* copying is not possible
+    SharedTickSource(const SharedTickSource &other) = delete;
+    //* moving is not possible
+    SharedTickSource(SharedTickSource &&other) = delete;
+    //* copying is not possible
+    SharedTickSource &operator=(const SharedTickSource &other) = delete;
+    //* moving is not possible
+    SharedTickSource &operator=(SharedTickSource &&other) = delete;
+
+    /**
+     * @brief set speed factor of the timer
+     * @details equivalent to timer.set_speed_factor(). The new speed factor is published with the next tick.
+     * @param factor speed factor
+     * @exception std::invalid_argument negative values or nan/inf
+     * @exception std::system_error call of setitimer failed
+     */
+    void set_speed_factor(double factor);
+
+    //* internal use only!
+    void on_tick(void *) noexcept override;
+};
+
+/**
+ * @brief class SharedTickReader
+ *
+ * @details maps the page of a SharedTickSource read only
+ */
+class SharedTickReader {
+private:
+    //* shared memory object
+    std::unique_ptr<SharedMemory> shm;
+
+    //* mapped page
+    const SharedTickPage *page;
+
+public:
+    /**
+     * @brief map page of a SharedTickSource
+     * @param name name of the shared memory object (see man shm_open)
+     * @exception std::system_error failed to open shared memory object
+     * @exception std::runtime_error not a page of a SharedTickSource
+     */
+    explicit SharedTickReader(const std::string &name);
+
+    //* unmap page
+    ~SharedTickReader();
+
+    //* copying is not possible
+    SharedTickReader(const SharedTickReader &other) = delete;
+    //* moving is not possible
+    SharedTickReader(SharedTickReader &&other) = delete;
+    //* copying is not possible
+    SharedTickReader &operator=(const SharedTickReader &other) = delete;
+    //* moving is not possible
+    SharedTickReader &operator=(SharedTickReader &&other) = delete;
+
+    /**
+     * @brief read consistent snapshot
+     * @return snapshot
+     */
+    [[nodiscard]] SharedTickSnapshot read() const noexcept;
+
+    /**
+     * @brief get number of ticks
+     * @return number of expirations since the source was created
+     */
+    [[nodiscard]] std::uint64_t get_ticks() const noexcept;
+
+    /**
+     * @brief block until more than the given number of ticks were published
+     * @param ticks last seen number of ticks
+     * @return current number of ticks
+     */
+    std::uint64_t wait_for_tick(std::uint64_t ticks) const noexcept;
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+
+namespace cxxitimer {
+
+class SharedMemory;
+struct SpeedCoordinationPage;
+
+//* speed factor change that is distributed by a SpeedCoordinator
+struct SpeedChange {
+    //* sequence number of the change (0: no change announced yet)
+    std::uint64_t generation;
+
+    //* new speed factor
+    double speed_factor;
+
+    //* CLOCK_MONOTONIC time at which the change is applied (nsec)
+    std::int64_t apply_at_nsec;
+};
+
+/**
+ * @brief class SpeedCoordinator
+ *
+ * @details
+ * Distributes speed factor changes to all cooperating processes via a shared memory page.
+ * Each change is applied by all processes (SpeedFollower) at a common instant (CLOCK_MONOTONIC).
+ * Since the speed factor change scales the remaining timer value, timers that were in phase stay in phase.
+ * The page keeps the last 16 changes: a follower that applies late replays the changes it missed.
+ *
+ * The shared memory object is removed when the coordinator is destroyed.
+ */
+class SpeedCoordinator {
+private:
+    //* shared memory object
+    std::unique_ptr<SharedMemory> shm;
+
+    //* mapped page
+    SpeedCoordinationPage *page;
+
+public:
+    /**
+     * @brief create shared memory page
+     * @param name name of the shared memory object (see man shm_open)
+     * @param mode permissions of the shared memory object
+     * @exception std::system_error failed to create shared memory object (EEXIST: object already exists)
+     */
+    explicit SpeedCoordinator(const std::string &name, mode_t mode = 0644);
+
+    //* destroy instance (removes the shared memory object)
+    ~SpeedCoordinator();
+
+    //* copying is not possible
+    SpeedCoordinator(const SpeedCoordinator &other) = delete;
+    //* moving is not possible
+    SpeedCoordinator(SpeedCoordinator &&other) = delete;
+    //* copying is not possible
+    SpeedCoordinator &operator=(const SpeedCoordinator &other) = delete;
+    //* moving is not possible
+    SpeedCoordinator &operator=(SpeedCoordinator &&other) = delete;
+
+    /**
+     * @brief announce speed factor change
+     * @details
+     *      The delay must be large enough for all processes to observe the change before it is applied.
+     *      A pending change that was not applied yet is replaced.
+     * @param factor new speed factor
+     * @param delay time until the change is applied
+     * @return sequence number of the change
+     * @exception std::invalid_argument negative values or nan/inf
+     */
+    std::uint64_t schedule(double factor, const timeval &delay);
+
+    /**
+     * @brief get the last announced change
+     * @return last announced change
+     */
+    [[nodiscard]] SpeedChange get_change() const noexcept;
+};
+
+/**
+ * @brief class SpeedFollower
+ *
+ * @details
+ * Applies the speed factor changes of a SpeedCoordinator to a timer of this process.
+ *
+ * A change that is applied after its instant (e.g. poll() is called late) is applied as of its instant: the remaining
+ * value of the timer is corrected for the time the timer ran with the old speed factor (see
+ * ITimer::set_speed_factor_since). Changes that were announced and became due since the last applied change are
+ * applied in order. If more than 16 changes were missed, the oldest of them are lost.
+ */
+class SpeedFollower {
+private:
+    //* timer
+    ITimer &timer;
+
+    //* shared memory object
+    std::unique_ptr<SharedMemory> shm;
+
+    //* mapped page
+    const SpeedCoordinationPage *page;
+
+    //* sequence number of the last applied change
+    std::uint64_t applied_generation;
+
+public:
+    /**
+     * @brief map page of a SpeedCoordinator
+     * @details changes that were announced before are not applied
+     * @param timer timer the changes are applied to
+     * @param name name of the shared memory object (see man shm_open)
+     * @exception std::system_error failed to open shared memory object
+     * @exception std::runtime_error not a page of a SpeedCoordinator
+     */
+    SpeedFollower(ITimer &timer, const std::string &name);
+
+    //* unmap page
+    ~SpeedFollower();
+
+    //* copying is not possible
+    SpeedFollower(const SpeedFollower &other) = delete;
+    //* moving is not possible
+    SpeedFollower(SpeedFollower &&other) = delete;
+    //* copying is not possible
+    SpeedFollower &operator=(const SpeedFollower &other) = delete;
+    //* moving is not possible
+    SpeedFollower &operator=(SpeedFollower &&other) = delete;
+
+    /**
+     * @brief apply the announced changes whose instant has been reached
+     * @details each change is applied as of its instant
+     * @return true change applied
+     * @return false no change due
+     * @exception std::system_error call of setitimer failed
+     */
+    bool poll();
+
+    /**
+     * @brief block until a new change is announced, sleep until its instant and apply it
+     * @details changes that were missed before are applied, too (in order)
+     * @return applied change (the last one if several changes were applied)
+     * @exception std::system_error call of setitimer or clock_nanosleep failed
+     */
+    SpeedChange wait_and_apply();
+
+    /**
+     * @brief get the last announced change
+     * @return last announced change
+     */
+    [[nodiscard]] SpeedChange get_change() const noexcept;
+};
+
+}  // namespace cxxitimer
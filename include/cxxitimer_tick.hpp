@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace cxxitimer {
+
+/**
+ * @brief abstract class TickHook
+ *
+ * @details
+ * A tick hook is invoked from the signal handler of the timer signal (SIGALRM/SIGVTALRM/SIGPROF) it is attached to.
+ * The library installs its own signal handler as long as at least one hook is attached to a signal.
+ * A previously installed signal handler is restored afterwards and is called after all hooks on each expiration.
+ *
+ * on_tick() is executed in signal context and must therefore be async-signal-safe!
+ *
+ * Derived classes must call detach() in their destructor.
+ */
+class TickHook {
+private:
+    //* signal the hook is attached to (0: not attached)
+    int signal = 0;
+
+protected:
+    //* internal use only!
+    TickHook() noexcept = default;
+
+public:
+    //! copying is not possible
+    TickHook(const TickHook &other) = delete;
+    //! moving is not possible
+    TickHook(TickHook &&other) = delete;
+    //! copying is not possible
+    TickHook &operator=(const TickHook &other) = delete;
+    //! moving is not possible
+    TickHook &operator=(TickHook &&other) = delete;
+
+    //* destroy the hook (detaches the hook if still attached)
+    virtual ~TickHook();
+
+    /**
+     * @brief attach hook to a timer signal
+     * @param signal timer signal (SIGALRM/SIGVTALRM/SIGPROF)
+     * @exception std::invalid_argument not a timer signal
+     * @exception std::logic_error hook already attached
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    void attach(int signal);
+
+    /**
+     * @brief attach hook to the signal of a timer
+     * @param timer timer
+     * @exception std::logic_error hook already attached
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    inline void attach(const ITimer &timer) { attach(timer.get_signal()); }
+
+    /**
+     * @brief detach hook
+     * @details
+     * Waits until no signal handler executes hooks of the signal anymore.
+     * Must not be called from within on_tick()!
+     */
+    void detach() noexcept;
+
+    /**
+     * @brief check if hook is attached
+     * @return true hook is attached
+     * @return false hook is not attached
+     */
+    [[nodiscard]] inline bool is_attached() const noexcept { return signal != 0; }
+
+    /**
+     * @brief get the signal the hook is attached to
+     * @return signal number (0 if not attached)
+     */
+    [[nodiscard]] inline int get_signal() const noexcept { return signal; }
+
+    /**
+     * @brief called on each timer expiration
+     * @details executed in signal context!
+     * @param context signal context (ucontext_t *) as passed to the signal handler
+     */
+    virtual void on_tick(void *context) noexcept = 0;
+};
+
+/**
+ * @brief class TickBroadcast
+ *
+ * @details
+ * Publishes a tick sequence number on each expiration of the timer it is attached to.
+ * Any number of threads can wait for the next tick.
+ * All blocked threads are woken with a single futex wake per tick.
+ * If no thread is blocked, publishing a tick does not require a system call.
+ */
+class TickBroadcast : public TickHook {
+private:
+    //* tick sequence number (futex word)
+    alignas(64) std::atomic<std::uint32_t> sequence {0};
+
+    //* number of threads blocked in wait_for_tick
+    alignas(64) std::atomic<std::uint32_t> waiters {0};
+
+public:
+    //* create TickBroadcast that is not attached (ticks can be published manually)
+    TickBroadcast() noexcept = default;
+
+    /**
+     * @brief create TickBroadcast attached to the signal of a timer
+     * @param timer timer
+     * @exception std::logic_error hook already attached
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    explicit TickBroadcast(const ITimer &timer);
+
+    //* destroy instance
+    ~TickBroadcast() override;
+
+    //* copying is not possible
+    TickBroadcast(const TickBroadcast &other) = delete;
+    //* moving is not possible
+    TickBroadcast(TickBroadcast &&other) = delete;
+    //* copying is not possible
+    TickBroadcast &operator=(const TickBroadcast &other) = delete;
+    //* moving is not possible
+    TickBroadcast &operator=(TickBroadcast &&other) = delete;
+
+    /**
+     * @brief publish a tick
+     * @details async-signal-safe
+     */
+    void publish() noexcept;
+
+    /**
+     * @brief get current tick sequence number
+     * @return tick sequence number
+     */
+    [[nodiscard]] inline std::uint32_t get_sequence() const noexcept {
+        return sequence.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief block until a tick newer than seq is published
+     * @param seq last seen tick sequence number
+     * @return current tick sequence number
+     */
+    std::uint32_t wait_for_tick(std::uint32_t seq) noexcept;
+
+    /**
+     * @brief block until a tick newer than seq is published or the timeout expired
+     * @param seq last seen tick sequence number
+     * @param timeout maximum time to wait
+     * @return current tick sequence number (equal to seq if the timeout expired)
+     */
+    std::uint32_t wait_for_tick(std::uint32_t seq, const timeval &timeout) noexcept;
+
+    /**
+     * @brief busy wait until a tick newer than seq is published
+     * @details does not perform any system call
+     * @param seq last seen tick sequence number
+     * @return current tick sequence number
+     */
+    std::uint32_t spin_for_tick(std::uint32_t seq) const noexcept;
+
+    //* internal use only!
+    inline void on_tick(void *) noexcept override { publish(); }
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace cxxitimer {
+
+/**
+ * @brief class TscClock
+ *
+ * @details
+ * Clock based on the time stamp counter of the CPU (rdtsc). Calibrated against CLOCK_MONOTONIC.
+ *
+ * The TSC is only used if the CPU provides an invariant TSC (constant rate, not stopped in deep sleep states)
+ * and after the clock was calibrated. Otherwise, CLOCK_MONOTONIC is used directly.
+ *
+ * The calibration is measured between the load of the library and the first call of recalibrate()
+ * (or explicitly with calibrate()). Each further call of recalibrate() measures the TSC rate over the time since
+ * the previous calibration. Call it periodically (e.g. every few seconds) to compensate for drift.
+ *
+ * The clock is monotonic: a new calibration continues from the time of the previous one and corrects the offset to
+ * CLOCK_MONOTONIC by adjusting the rate by at most MAX_SLEW_PPM for at most MAX_SLEW_TIME (it is slewed, not stepped).
+ * A larger offset is corrected by the following calibrations.
+ *
+ * now() is async-signal-safe and can be called concurrently with recalibrate().
+ * Satisfies the requirements of Clock (std::chrono).
+ */
+class TscClock {
+public:
+    using duration   = std::chrono::nanoseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::time_point<TscClock, duration>;
+
+    static constexpr bool is_steady = true;
+
+    //* maximum rate adjustment to correct the offset to CLOCK_MONOTONIC (parts per million)
+    static constexpr double MAX_SLEW_PPM = 500.0;
+
+    //* maximum duration of the offset correction after a calibration
+    static constexpr duration MAX_SLEW_TIME = std::chrono::milliseconds(500);
+
+    /**
+     * @brief get current time
+     * @return time since the epoch of CLOCK_MONOTONIC
+     */
+    [[nodiscard]] static time_point now() noexcept;
+
+    /**
+     * @brief read time stamp counter
+     * @return time stamp counter (0 if not available)
+     */
+    [[nodiscard]] static std::uint64_t read_tsc() noexcept;
+
+    /**
+     * @brief check for invariant TSC
+     * @return true CPU provides an invariant TSC
+     * @return false TSC not available or not invariant
+     */
+    [[nodiscard]] static bool is_invariant() noexcept;
+
+    /**
+     * @brief check if the TSC is used
+     * @return true TSC is invariant and the clock is calibrated
+     * @return false CLOCK_MONOTONIC is used
+     */
+    [[nodiscard]] static bool is_calibrated() noexcept;
+
+    /**
+     * @brief get calibrated TSC frequency
+     * @details measured frequency without the offset correction
+     * @return frequency (Hz). 0 if not calibrated.
+     */
+    [[nodiscard]] static double get_frequency() noexcept;
+
+    /**
+     * @brief calibrate by busy waiting
+     * @details no effect if the TSC is not invariant
+     * @param calibration_time measurement duration
+     */
+    static void calibrate(duration calibration_time = std::chrono::milliseconds(10)) noexcept;
+
+    /**
+     * @brief recalibrate using the time since the last calibration
+     * @details
+     *      no effect if the TSC is not invariant or if less than 1ms passed since the last calibration.
+     *      Must not be called concurrently from multiple threads.
+     */
+    static void recalibrate() noexcept;
+
+private:
+    TscClock() = default;
+};
+
+}  // namespace cxxitimer
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "cxxitimer_tick.hpp"
+#include "cxxitimer_tsc.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <list>
+
+namespace cxxitimer {
+
+/**
+ * @brief class SliceBudget
+ *
+ * @details time budget of a slice. Checked with the TscClock (cheap enough to be checked after each unit of work).
+ */
+class SliceBudget {
+private:
+    //* end of the slice
+    TscClock::time_point deadline;
+
+public:
+    /**
+     * @brief create budget
+     * @param deadline end of the slice
+     */
+    explicit SliceBudget(TscClock::time_point deadline) noexcept : deadline(deadline) {}
+
+    /**
+     * @brief check if the budget is used up
+     * @return true budget used up
+     * @return false budget left
+     */
+    [[nodiscard]] inline bool expired() const noexcept { return TscClock::now() >= deadline; }
+
+    /**
+     * @brief get remaining budget
+     * @return remaining budget (negative if expired)
+     */
+    [[nodiscard]] inline TscClock::duration remaining() const noexcept { return deadline - TscClock::now(); }
+};
+
+/**
+ * @brief class WorkSlicer
+ *
+ * @details
+ * Executes incremental background jobs in time bounded slices on each expiration of a timer.
+ *
+ * A job performs units of work until SliceBudget::expired() returns true and returns whether it is complete.
+ * Complete jobs are removed. Incomplete jobs are resumed with the next slice.
+ * Jobs are executed round robin. Each slice starts with the job that follows the last job of the previous slice.
+ *
+ * The slicer is not thread safe. Jobs may add and remove jobs (including themselves).
+ */
+class WorkSlicer {
+public:
+    //* incremental job (returns true if the job is complete)
+    using job_t = std::function<bool(const SliceBudget &)>;
+
+    //* identifies a job
+    using job_id = std::uint64_t;
+
+private:
+    //* registered job
+    struct Job {
+        //* job id
+        job_id id;
+
+        //* job function
+        job_t job;
+
+        //* removed or complete (erased when it is not executed)
+        bool removed = false;
+    };
+
+    //* registered jobs
+    std::list<Job> jobs;
+
+    //* next job to execute
+    std::list<Job>::iterator cursor;
+
+    //* time budget per slice
+    TscClock::duration budget;
+
+    //* last assigned job id
+    job_id last_id = 0;
+
+    //* notifies about expirations of the timer
+    TickBroadcast broadcast;
+
+    //* last processed tick sequence number
+    std::uint32_t sequence;
+
+public:
+    /**
+     * @brief create slicer
+     * @param timer timer that drives the slicer
+     * @param budget time budget per slice
+     * @exception std::runtime_error too many hooks attached to the signal
+     * @exception std::system_error call of sigaction failed
+     */
+    WorkSlicer(const ITimer &timer, TscClock::duration budget);
+
+    //* destroy slicer
+    ~WorkSlicer();
+
+    //* copying is not possible
+    WorkSlicer(const WorkSlicer &other) = delete;
+    //* moving is not possible
+    WorkSlicer(WorkSlicer &&other) = delete;
+    //* copying is not possible
+    WorkSlicer &operator=(const WorkSlicer &other) = delete;
+    //* moving is not possible
+    WorkSlicer &operator=(WorkSlicer &&other) = delete;
+
+    /**
+     * @brief add job
+     * @param job job
+     * @return job id
+     */
+    job_id add_job(job_t job);
+
+    /**
+     * @brief remove job
+     * @param id job id
+     * @return true job removed
+     * @return false no such job (already complete or removed)
+     */
+    bool remove_job(job_id id) noexcept;
+
+    /**
+     * @brief execute jobs until the budget is used up or each job was executed once
+     * @return number of executed jobs
+     */
+    std::size_t run_slice();
+
+    /**
+     * @brief wait for the next expiration and execute a slice
+     * @return number of executed jobs
+     */
+    std::size_t wait_and_run();
+
+    /**
+     * @brief set time budget per slice
+     * @param new_budget time budget per slice
+     */
+    inline void set_budget(TscClock::duration new_budget) noexcept { budget = new_budget; }
+
+    /**
+     * @brief get number of incomplete jobs
+     * @return number of incomplete jobs
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+};
+
+}  // namespace cxxitimer
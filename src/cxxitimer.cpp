@@ -5,8 +5,23 @@
 
 #include "cxxitimer.hpp"
 
+#include "cxxitimer_tick.hpp"
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
 #include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <sysexits.h>
 
 
@@ -18,6 +33,79 @@ static constexpr itimerval STOP_TIMER = {{0, 0}, {0, 0}};
 //* number of usec per second
 constexpr auto USEC_PER_SEC = static_cast<double>(1000000);
 
+//* format version of the handoff state
+static constexpr int HANDOFF_VERSION = 1;
+
+//* get the environment variable that carries the handoff state of a timer type
+static const char *handoff_variable(int type) noexcept {
+    switch (type) {
+        case ITIMER_REAL: return "CXXITIMER_HANDOFF_REAL";
+        case ITIMER_VIRTUAL: return "CXXITIMER_HANDOFF_VIRTUAL";
+        case ITIMER_PROF: return "CXXITIMER_HANDOFF_PROF";
+        default: return "CXXITIMER_HANDOFF";
+    }
+}
+
+//* number of timer types (ITIMER_REAL, ITIMER_VIRTUAL, ITIMER_PROF)
+static constexpr std::size_t TIMER_TYPES = 3;
+
+//* existing timer instances (index: timer type) for the fork handling
+static std::atomic<ITimer *> instances[TIMER_TYPES];
+
+namespace {
+
+/**
+ * @brief holds the state lock of a timer
+ * @details only waits for signal handlers of other threads that apply a coalesced speed factor
+ */
+class StateGuard {
+private:
+    std::atomic_flag &lock;
+
+public:
+    explicit StateGuard(std::atomic_flag &_lock) noexcept : lock(_lock) {
+        while (lock.test_and_set(std::memory_order_acquire))
+            sched_yield();
+    }
+
+    ~StateGuard() { lock.clear(std::memory_order_release); }
+
+    StateGuard(const StateGuard &other)            = delete;
+    StateGuard(StateGuard &&other)                 = delete;
+    StateGuard &operator=(const StateGuard &other) = delete;
+    StateGuard &operator=(StateGuard &&other)      = delete;
+};
+
+}  // namespace
+
+/**
+ * @brief internal use only! applies the coalesced speed factor of a timer on its expirations
+ */
+class PendingSpeedHook : public TickHook {
+private:
+    ITimer &timer;
+
+public:
+    explicit PendingSpeedHook(ITimer &_timer) : timer(_timer) { attach(timer); }
+
+    ~PendingSpeedHook() override { detach(); }
+
+    PendingSpeedHook(const PendingSpeedHook &other)            = delete;
+    PendingSpeedHook(PendingSpeedHook &&other)                 = delete;
+    PendingSpeedHook &operator=(const PendingSpeedHook &other) = delete;
+    PendingSpeedHook &operator=(PendingSpeedHook &&other)      = delete;
+
+    void on_tick(void *) noexcept override {
+        if (!(timer.pending_speed_factor.load(std::memory_order_relaxed) > 0.0)) return;
+
+        // the timer is currently changed: retry on the next expiration
+        if (timer.state_lock.test_and_set(std::memory_order_acquire)) return;
+        timer.apply_due_speed_factor();
+        timer.state_lock.clear(std::memory_order_release);
+    }
+};
+
+
 
 bool ITimer_Real::instance_exists    = false;
 bool ITimer_Virtual::instance_exists = false;
@@ -56,82 +144,340 @@ ITimer::ITimer(int type, double interval, double value) noexcept
 {}
 
 
+namespace {
+
+//* error category of timer_errc
+class TimerCategory : public std::error_category {
+public:
+    [[nodiscard]] const char *name() const noexcept override { return "cxxitimer"; }
+
+    [[nodiscard]] std::string message(int ev) const override {
+        switch (static_cast<timer_errc>(ev)) {
+            case timer_errc::already_started: return "timer already started";
+            case timer_errc::already_stopped: return "timer already stopped";
+            case timer_errc::negative_interval: return "timer interval is negative";
+            case timer_errc::negative_value: return "timer value is negative";
+            case timer_errc::interval_too_small: return "invalid timer values due to to a to small speed factor";
+            case timer_errc::negative_speed_factor: return "negative values not allowed";
+            case timer_errc::invalid_speed_factor: return "invalid double value";
+            default: return "unknown error";
+        }
+    }
+};
+
+/**
+ * @brief throw the exception that corresponds to an error code
+ * @param ec error code
+ * @param what message of std::system_error
+ */
+[[noreturn]] void throw_error(const std::error_code &ec, const char *what) {
+    if (ec.category() != timer_category()) throw std::system_error(ec, what);
+
+    const auto message = ec.message();
+    switch (static_cast<timer_errc>(ec.value())) {
+        case timer_errc::already_started: throw std::logic_error(message);
+        case timer_errc::negative_speed_factor:
+        case timer_errc::invalid_speed_factor: throw std::invalid_argument(message);
+        case timer_errc::already_stopped:
+        case timer_errc::negative_interval:
+        case timer_errc::negative_value:
+        case timer_errc::interval_too_small:
+        default: throw std::runtime_error(message);
+    }
+}
+
+}  // namespace
+
+const std::error_category &timer_category() noexcept {
+    static const TimerCategory category;
+    return category;
+}
+
+std::error_code make_error_code(timer_errc e) noexcept {
+    return {static_cast<int>(e), timer_category()};
+}
+
 ITimer::~ITimer() {
+    // no coalesced speed factor is applied from now on
+    pending_hook.reset();
+
+    // unregister instance
+    if (static_cast<std::size_t>(type) < TIMER_TYPES) {
+        ITimer *expected = this;
+        instances[type].compare_exchange_strong(expected, nullptr);
+    }
+
     // stop timer if running
     if (running) {
-        try {
-            stop();
-        } catch (const std::exception &e) {
-            std::cerr << "Exception in destructor (" << __PRETTY_FUNCTION__ << "): " << e.what() << '\n';
+        std::error_code ec;
+        stop(ec);
+        if (ec) {
+            std::cerr << "Error in destructor (" << __PRETTY_FUNCTION__ << "): " << ec.message() << '\n';
             exit(EX_SOFTWARE);
         }
     }
 }
 
-void ITimer::adjust_speed(double new_factor) {
-    if (!running) throw std::runtime_error("timer not running");
+void ITimer::adjust_speed(double new_factor, std::int64_t late_nsec, std::error_code &ec) noexcept {
+    ec.clear();
+    if (!running) {
+        ec = timer_errc::already_stopped;
+        return;
+    }
 
     itimerval val {};
     int       tmp = setitimer(type, &STOP_TIMER, &val);
-    if (tmp) throw std::system_error(errno, std::generic_category(), "call of setitimer failed");
+    if (tmp) {
+        ec = std::error_code(errno, std::generic_category());
+        return;
+    }
 
     // set timer interval
     val.it_interval = timer_interval / new_factor;
 
     // scale timer value
-    val.it_value *= speed_factor / new_factor;
+    if (late_nsec > 0) {
+        // the timer ran with the old speed factor for late_nsec: rescale this time, too (keeps the phase)
+        const auto interval  = timeval_to_nsec(val.it_interval);
+        const auto at_change = static_cast<double>(timeval_to_nsec(val.it_value) + late_nsec);
+        auto       value     = static_cast<std::int64_t>(at_change * speed_factor / new_factor) - late_nsec;
+
+        // expiration already passed: next expiration in the same phase
+        if (value <= 0) value = interval > 0 ? interval - (-value) % interval : 0;
+        val.it_value = nsec_to_timeval(std::max(value, NSEC_PER_USEC));
+    } else {
+        val.it_value *= speed_factor / new_factor;
+    }
 
     // set new timer value
     tmp = setitimer(type, &val, nullptr);
-    if (tmp) throw std::system_error(errno, std::generic_category(), "call of setitimer failed");
+    if (tmp) {
+        ec = std::error_code(errno, std::generic_category());
+        return;
+    }
 
     // save speed factor
     speed_factor = new_factor;
 }
 
 void ITimer::start() {
-    if (running) throw std::logic_error("timer already started");
+    std::error_code ec;
+    start(ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+}
+
+void ITimer::start(std::error_code &ec) noexcept {
+    ec.clear();
+    StateGuard guard(state_lock);
+    if (running) {
+        ec = timer_errc::already_started;
+        return;
+    }
 
     // create scaled timer value
     itimerval timer_val {timer_interval / speed_factor, timer_value / speed_factor};
 
-    if (timer_val.it_interval.tv_sec < 0) throw std::runtime_error("timer interval is negative");
+    if (timer_val.it_interval.tv_sec < 0) {
+        ec = timer_errc::negative_interval;
+        return;
+    }
 
-    if (timer_val.it_value.tv_sec < 0) throw std::runtime_error("timer value is negative");
+    if (timer_val.it_value.tv_sec < 0) {
+        ec = timer_errc::negative_value;
+        return;
+    }
 
-    if (timer_val.it_interval.tv_sec == 0 && timer_val.it_interval.tv_usec == 0)
-        throw std::runtime_error("invalid timer values due to to a to small speed factor");
+    if (timer_val.it_interval.tv_sec == 0 && timer_val.it_interval.tv_usec == 0) {
+        ec = timer_errc::interval_too_small;
+        return;
+    }
 
     // start timer;
     int tmp = setitimer(type, &timer_val, nullptr);
-    if (tmp < 0) throw std::system_error(errno, std::generic_category(), "call of setitimer failed");
+    if (tmp < 0) {
+        ec = std::error_code(errno, std::generic_category());
+        return;
+    }
 
     running = true;
 }
 
 void ITimer::stop() {
-    if (!running) throw std::runtime_error("timer already stopped");
+    std::error_code ec;
+    stop(ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+}
+
+void ITimer::stop(std::error_code &ec) noexcept {
+    ec.clear();
+    StateGuard guard(state_lock);
+    if (!running) {
+        ec = timer_errc::already_stopped;
+        return;
+    }
 
     // stop timer and save value
     itimerval timer_val {};
     int       tmp = setitimer(type, &STOP_TIMER, &timer_val);
-    if (tmp < 0) throw std::system_error(errno, std::generic_category(), "call of setitimer failed");
+    if (tmp < 0) {
+        ec = std::error_code(errno, std::generic_category());
+        return;
+    }
 
     // normalize value
     timer_value = timer_val.it_value * speed_factor;
 
     running = false;
+
+    // recorded speed factor can be applied without adjusting the timer
+    const auto pending = pending_speed_factor.exchange(0.0);
+    if (pending > 0.0) speed_factor = pending;
 }
 
 void ITimer::set_speed_factor(double factor) {
+    std::error_code ec;
+    set_speed_factor(factor, ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+}
+
+void ITimer::set_speed_factor(double factor, std::error_code &ec) noexcept {
+    ec.clear();
+
     // check speed_factor
-    if (factor <= 0.0) throw std::invalid_argument("negative values not allowed");
+    if (factor <= 0.0) {
+        ec = timer_errc::negative_speed_factor;
+        return;
+    }
 
-    if (std::isnan(factor) || std::isinf(factor)) throw std::invalid_argument("invalid double value");
+    if (std::isnan(factor) || std::isinf(factor)) {
+        ec = timer_errc::invalid_speed_factor;
+        return;
+    }
 
-    if (running) adjust_speed(factor);
-    else
+    StateGuard guard(state_lock);
+    if (!running) {
+        speed_factor         = factor;
+        pending_speed_factor = 0.0;
+        return;
+    }
+
+    // nothing to do if the speed factor does not change
+    if (!std::islessgreater(factor, speed_factor.load())) {
+        pending_speed_factor = 0.0;
+        return;
+    }
+
+    if (coalescing_period > 0) {
+        // only record speed factor if the last adjustment is too recent
+        const auto now = monotonic_nsec();
+        if (now - last_adjustment < coalescing_period) {
+            pending_speed_factor = factor;
+            return;
+        }
+        last_adjustment = now;
+    }
+
+    pending_speed_factor = 0.0;
+    adjust_speed(factor, 0, ec);
+}
+
+void ITimer::set_speed_factor_since(double factor, std::int64_t since_nsec) {
+    std::error_code ec;
+    set_speed_factor_since(factor, since_nsec, ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+}
+
+void ITimer::set_speed_factor_since(double factor, std::int64_t since_nsec, std::error_code &ec) noexcept {
+    ec.clear();
+
+    // check speed_factor
+    if (factor <= 0.0) {
+        ec = timer_errc::negative_speed_factor;
+        return;
+    }
+
+    if (std::isnan(factor) || std::isinf(factor)) {
+        ec = timer_errc::invalid_speed_factor;
+        return;
+    }
+
+    StateGuard guard(state_lock);
+    pending_speed_factor = 0.0;
+    if (!running) {
         speed_factor = factor;
+        return;
+    }
+
+    // nothing to do if the speed factor does not change (no correction required)
+    if (!std::islessgreater(factor, speed_factor.load())) return;
+
+    // only the time of ITIMER_REAL passes with CLOCK_MONOTONIC
+    const auto now  = monotonic_nsec();
+    const auto late = type == ITIMER_REAL ? std::max<std::int64_t>(now - since_nsec, 0) : 0;
+
+    last_adjustment = now;
+    adjust_speed(factor, late, ec);
+}
+
+void ITimer::set_speed_coalescing(const timeval &min_period) {
+    {
+        StateGuard guard(state_lock);
+        coalescing_period = std::int64_t {min_period.tv_sec} * NSEC_PER_SEC + min_period.tv_usec * NSEC_PER_USEC;
+    }
+    update_pending_hook();
+}
+
+void ITimer::set_speed_coalescing(double min_period) {
+    set_speed_coalescing(double_to_timeval(min_period));
+}
+
+void ITimer::update_pending_hook() {
+    if (coalescing_period > 0) {
+        if (!pending_hook) pending_hook = std::make_unique<PendingSpeedHook>(*this);
+    } else {
+        pending_hook.reset();
+        apply_pending_speed_factor();
+    }
+}
+
+void ITimer::apply_due_speed_factor() noexcept {
+    const auto factor = pending_speed_factor.load(std::memory_order_relaxed);
+    if (!(factor > 0.0) || !running) return;
+
+    const auto now = monotonic_nsec();
+    if (now - last_adjustment < coalescing_period) return;
+
+    // on error: retried on the next expiration
+    std::error_code ec;
+    adjust_speed(factor, 0, ec);
+    if (ec) return;
+
+    pending_speed_factor.store(0.0, std::memory_order_relaxed);
+    last_adjustment = now;
+}
+
+bool ITimer::apply_pending_speed_factor() {
+    std::error_code ec;
+    const bool      applied = apply_pending_speed_factor(ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+    return applied;
+}
+
+bool ITimer::apply_pending_speed_factor(std::error_code &ec) noexcept {
+    ec.clear();
+    StateGuard guard(state_lock);
+
+    const auto factor = pending_speed_factor.exchange(0.0);
+    if (factor <= 0.0) return false;
+
+    if (running) {
+        last_adjustment = monotonic_nsec();
+        adjust_speed(factor, 0, ec);
+    } else {
+        speed_factor = factor;
+    }
+
+    return !ec;
 }
 
 void ITimer::set_interval_value(const timeval &interval, const timeval &value) {
@@ -146,26 +492,61 @@ void ITimer::set_interval_value(double interval, double value) {
 }
 
 void ITimer::set_speed_to_normal() {
+    std::error_code ec;
+    set_speed_to_normal(ec);
+    if (ec) throw_error(ec, "call of setitimer failed");
+}
+
+void ITimer::set_speed_to_normal(std::error_code &ec) noexcept {
+    ec.clear();
+    StateGuard guard(state_lock);
+    pending_speed_factor = 0.0;
+
     // adjust speed if running
-    if (running) adjust_speed(1.0);
+    if (running) adjust_speed(1.0, 0, ec);
     else
         speed_factor = 1.0;
 }
 
 void ITimer::to_fstream(std::ofstream &fstream) const {
-    itimerval val {};
-    if (running) {
-        int tmp = getitimer(type, &val);
-        if (tmp < 0) throw std::system_error(errno, std::generic_category(), "call of getitimer failed");
+    std::error_code ec;
+    to_fstream(fstream, ec);
+    if (ec) throw_error(ec, ec.category() == std::iostream_category() ? "failed to write" : "call of getitimer failed");
+}
 
-        val.it_value *= speed_factor;
-    } else {
-        val.it_value = timer_value;
+void ITimer::to_fstream(std::ofstream &fstream, std::error_code &ec) const noexcept {
+    ec.clear();
+
+    itimerval val {};
+    {
+        StateGuard guard(state_lock);
+        if (running) {
+            int tmp = getitimer(type, &val);
+            if (tmp < 0) {
+                ec = std::error_code(errno, std::generic_category());
+                return;
+            }
+
+            val.it_value *= speed_factor;
+        } else {
+            val.it_value = timer_value;
+        }
     }
 
     val.it_interval = timer_interval;
 
-    fstream.write(reinterpret_cast<char *>(&val), sizeof(val));
+    // the stream might be configured to throw on errors
+    try {
+        fstream.write(reinterpret_cast<char *>(&val), sizeof(val));
+    } catch (const std::ios_base::failure &e) {
+        ec = e.code();
+        return;
+    } catch (...) {
+        ec = std::io_errc::stream;
+        return;
+    }
+
+    if (!fstream) ec = std::io_errc::stream;
 }
 
 void ITimer::from_fstream(std::ifstream &fstream) {
@@ -177,40 +558,230 @@ void ITimer::from_fstream(std::ifstream &fstream) {
     timer_value    = val.it_value;
 }
 
+void ITimer::prepare_exec_handoff() {
+    std::ostringstream state;
+    {
+        StateGuard guard(state_lock);
+
+        itimerval val {};
+        if (running) {
+            if (getitimer(type, &val))
+                throw std::system_error(errno, std::generic_category(), "call of getitimer failed");
+            val.it_value *= speed_factor;
+        } else {
+            val.it_value = timer_value;
+        }
+
+        // the speed factor is stored bitwise to hand it over without rounding
+        state << HANDOFF_VERSION << ' ' << timer_interval.tv_sec << ' ' << timer_interval.tv_usec << ' '
+              << val.it_value.tv_sec << ' ' << val.it_value.tv_usec << ' '
+              << std::bit_cast<std::uint64_t>(speed_factor.load()) << ' ' << running << ' ' << coalescing_period;
+    }
+
+    // the handler is reset by execve: block the signal until the new image installs its handler
+    sigset_t set;
+    sigset_t old_set;
+    sigemptyset(&set);
+    sigaddset(&set, get_signal());
+    int tmp = pthread_sigmask(SIG_BLOCK, &set, &old_set);
+    if (tmp) throw std::system_error(tmp, std::generic_category(), "call of pthread_sigmask failed");
+    const bool blocked = !sigismember(&old_set, get_signal());
+
+    if (setenv(handoff_variable(type), state.str().c_str(), 1)) {
+        const int error = errno;
+
+        // no handoff: restore the signal mask
+        if (blocked) pthread_sigmask(SIG_SETMASK, &old_set, nullptr);
+        throw std::system_error(error, std::generic_category(), "call of setenv failed");
+    }
+
+    if (blocked) handoff_blocked_signal = true;
+}
+
+void ITimer::cancel_exec_handoff() {
+    if (unsetenv(handoff_variable(type)))
+        throw std::system_error(errno, std::generic_category(), "call of unsetenv failed");
+
+    if (handoff_blocked_signal) {
+        sigset_t set;
+        sigemptyset(&set);
+        sigaddset(&set, get_signal());
+        int tmp = pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
+        if (tmp) throw std::system_error(tmp, std::generic_category(), "call of pthread_sigmask failed");
+        handoff_blocked_signal = false;
+    }
+}
+
+bool ITimer::adopt_handoff_state() {
+    const char *variable = handoff_variable(type);
+    const char *env      = getenv(variable);
+    if (!env) return false;
+
+    // the state is consumed: it must not be handed over to further child processes
+    const std::string state(env);
+    unsetenv(variable);
+
+    std::istringstream stream(state);
+    int                version       = 0;
+    long long          interval_sec  = 0;
+    long long          interval_usec = 0;
+    long long          value_sec     = 0;
+    long long          value_usec    = 0;
+    std::uint64_t      factor_bits   = 0;
+    bool               was_running   = false;
+    long long          coalescing    = 0;
+    stream >> version >> interval_sec >> interval_usec >> value_sec >> value_usec >> factor_bits >> was_running >>
+            coalescing;
+    if (!stream || version != HANDOFF_VERSION) throw std::runtime_error("invalid handoff state");
+
+    const auto factor = std::bit_cast<double>(factor_bits);
+    if (!(factor > 0.0) || std::isinf(factor)) throw std::runtime_error("invalid handoff state");
+
+    bool kernel_running = false;
+    if (was_running) {
+        itimerval val {};
+        if (getitimer(type, &val)) throw std::system_error(errno, std::generic_category(), "call of getitimer failed");
+        kernel_running = val.it_value.tv_sec != 0 || val.it_value.tv_usec != 0;
+        if (!kernel_running) {
+            // timer was stopped in between: start with a full period
+            value_sec  = interval_sec;
+            value_usec = interval_usec;
+        }
+    }
+
+    timer_interval    = {static_cast<time_t>(interval_sec), static_cast<suseconds_t>(interval_usec)};
+    timer_value       = {static_cast<time_t>(value_sec), static_cast<suseconds_t>(value_usec)};
+    speed_factor      = factor;
+    coalescing_period = coalescing;
+    running           = kernel_running;
+    update_pending_hook();
+    return true;
+}
+
 timeval ITimer::get_timer_value() const {
+    std::error_code ec;
+    auto            value = get_timer_value(ec);
+    if (ec) throw_error(ec, "call of getitimer failed");
+    return value;
+}
+
+timeval ITimer::get_timer_value(std::error_code &ec) const noexcept {
+    ec.clear();
+    StateGuard guard(state_lock);
     if (running) {
         itimerval temp {};
         int       tmp = getitimer(type, &temp);
-        if (tmp < 0) throw std::system_error(errno, std::generic_category(), "call of getitimer failed");
+        if (tmp < 0) {
+            ec = std::error_code(errno, std::generic_category());
+            return {0, 0};
+        }
         return temp.it_value;
     } else
         return timer_value;
 }
 
+void ITimer::register_instance() noexcept {
+    // install the fork handlers once
+    static const int atfork = pthread_atfork(on_fork_prepare, nullptr, on_fork_child);
+    static_cast<void>(atfork);
+
+    if (static_cast<std::size_t>(type) < TIMER_TYPES) instances[type] = this;
+}
+
+void ITimer::on_fork_prepare() noexcept {
+    for (auto &instance : instances) {
+        auto *timer = instance.load();
+        if (!timer || !timer->running || timer->fork_policy != ForkPolicy::resume) continue;
+
+        itimerval val {};
+        if (getitimer(timer->type, &val) == 0) timer->fork_value = val.it_value;
+        else
+            timer->fork_value = timer->timer_interval / timer->speed_factor;
+    }
+}
+
+void ITimer::on_fork_child() noexcept {
+    // only async-signal-safe operations: the parent may be multithreaded
+    for (auto &instance : instances) {
+        auto *timer = instance.load();
+        if (!timer) continue;
+
+        // the lock might have been held by a signal handler of another thread of the parent
+        timer->state_lock.clear();
+        if (!timer->running) continue;
+
+        // a recorded (coalesced) speed factor is applied by all policies
+        if (const auto pending = timer->pending_speed_factor.exchange(0.0); pending > 0.0)
+            timer->speed_factor = pending;
+
+        itimerval val {timer->timer_interval / timer->speed_factor, timer->timer_interval / timer->speed_factor};
+        switch (timer->fork_policy) {
+            case ForkPolicy::stop:
+                timer->timer_value = timer->timer_interval;
+                timer->running     = false;
+                break;
+            case ForkPolicy::resume:
+                // an expired timer has the value {0, 0}, which would not arm it
+                if (timer->fork_value.tv_sec != 0 || timer->fork_value.tv_usec != 0) val.it_value = timer->fork_value;
+                [[fallthrough]];
+            case ForkPolicy::restart:
+                if (setitimer(timer->type, &val, nullptr) != 0) {
+                    timer->timer_value = timer->timer_interval;
+                    timer->running     = false;
+                }
+                break;
+            default: break;
+        }
+    }
+}
+
+int ITimer::get_signal() const noexcept {
+    switch (type) {
+        case ITIMER_REAL: return SIGALRM;
+        case ITIMER_VIRTUAL: return SIGVTALRM;
+        case ITIMER_PROF: return SIGPROF;
+        default: return 0;
+    }
+}
+
 ITimer_Real::ITimer_Real(const timeval &interval) : ITimer(ITIMER_REAL, interval) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Real::ITimer_Real(const timeval &interval, const timeval &value) : ITimer(ITIMER_REAL, interval, value) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Real::ITimer_Real(double interval) : ITimer(ITIMER_REAL, interval) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Real::ITimer_Real(double interval, double value) : ITimer(ITIMER_REAL, interval, value) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
+ITimer_Real::ITimer_Real(adopt_handoff_t, const timeval &interval) : ITimer(ITIMER_REAL, interval) {
+    // prevent multiple instances
+    if (instance_exists) throw std::logic_error("instance exists");
+    adopt_handoff_state();
+    instance_exists = true;
+    register_instance();
+}
+
+ITimer_Real::ITimer_Real(adopt_handoff_t tag, double interval) : ITimer_Real(tag, double_to_timeval(interval)) {}
+
 ITimer_Real::~ITimer_Real() {
     // allow new instance
     instance_exists = false;
@@ -220,6 +791,7 @@ ITimer_Virtual::ITimer_Virtual(const timeval &interval) : ITimer(ITIMER_VIRTUAL,
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Virtual::ITimer_Virtual(const timeval &interval, const timeval &value)
@@ -227,20 +799,34 @@ ITimer_Virtual::ITimer_Virtual(const timeval &interval, const timeval &value)
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Virtual::ITimer_Virtual(double interval) : ITimer(ITIMER_VIRTUAL, interval) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Virtual::ITimer_Virtual(double interval, double value) : ITimer(ITIMER_VIRTUAL, interval, value) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
+ITimer_Virtual::ITimer_Virtual(adopt_handoff_t, const timeval &interval) : ITimer(ITIMER_VIRTUAL, interval) {
+    // prevent multiple instances
+    if (instance_exists) throw std::logic_error("instance exists");
+    adopt_handoff_state();
+    instance_exists = true;
+    register_instance();
+}
+
+ITimer_Virtual::ITimer_Virtual(adopt_handoff_t tag, double interval)
+    : ITimer_Virtual(tag, double_to_timeval(interval)) {}
+
 ITimer_Virtual::~ITimer_Virtual() {
     // allow new instance
     instance_exists = false;
@@ -250,26 +836,40 @@ ITimer_Prof::ITimer_Prof(const timeval &interval) : ITimer(ITIMER_PROF, interval
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Prof::ITimer_Prof(const timeval &interval, const timeval &value) : ITimer(ITIMER_PROF, interval, value) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Prof::ITimer_Prof(double interval) : ITimer(ITIMER_PROF, interval) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
 }
 
 ITimer_Prof::ITimer_Prof(double interval, double value) : ITimer(ITIMER_PROF, interval, value) {
     // prevent multiple instances
     if (instance_exists) throw std::logic_error("instance exists");
     instance_exists = true;
+    register_instance();
+}
+
+ITimer_Prof::ITimer_Prof(adopt_handoff_t, const timeval &interval) : ITimer(ITIMER_PROF, interval) {
+    // prevent multiple instances
+    if (instance_exists) throw std::logic_error("instance exists");
+    adopt_handoff_state();
+    instance_exists = true;
+    register_instance();
 }
 
+ITimer_Prof::ITimer_Prof(adopt_handoff_t tag, double interval) : ITimer_Prof(tag, double_to_timeval(interval)) {}
+
 ITimer_Prof::~ITimer_Prof() {
     // allow new instance
     instance_exists = false;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_adaptive_interval.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace cxxitimer {
+
+//* speed factor including a coalesced change that is not applied yet
+static double effective_speed_factor(const ITimer &timer) noexcept {
+    const auto pending = timer.get_pending_speed_factor();
+    return pending > 0.0 ? pending : timer.get_speed_factor();
+}
+
+AdaptiveInterval::AdaptiveInterval(ITimer &_timer, const Parameters &_parameters)
+    : timer(_timer), parameters(_parameters) {
+    if (!(parameters.min_period > 0.0) || parameters.max_period < parameters.min_period)
+        throw std::invalid_argument("invalid period bounds");
+
+    if (parameters.low_load < 0.0 || parameters.high_load < parameters.low_load)
+        throw std::invalid_argument("invalid load thresholds");
+
+    if (!(parameters.lengthen_factor > 1.0) || !(parameters.shorten_factor > 0.0 && parameters.shorten_factor < 1.0))
+        throw std::invalid_argument("invalid adjustment factors");
+
+    if (parameters.window == 0) throw std::invalid_argument("window must not be 0");
+
+    if (!(timeval_to_double(timer.get_interval()) > 0.0))
+        throw std::invalid_argument("timer interval must be positive");
+}
+
+bool AdaptiveInterval::record(std::chrono::nanoseconds duration, std::size_t backlog) {
+    duration_sum += std::chrono::duration<double>(duration).count();
+    backlog_sum += backlog;
+    if (++observations < parameters.window) return false;
+
+    const auto period      = get_period();
+    const auto load        = duration_sum / static_cast<double>(observations) / period;
+    const bool has_backlog = backlog_sum != 0;
+
+    duration_sum = 0.0;
+    backlog_sum  = 0;
+    observations = 0;
+
+    if (load > parameters.high_load) return set_period(period * parameters.lengthen_factor);
+    if (has_backlog) return set_period(period * parameters.shorten_factor);
+    if (load < parameters.low_load) return set_period(period * parameters.lengthen_factor);
+    return false;
+}
+
+double AdaptiveInterval::get_period() const noexcept {
+    return timeval_to_double(timer.get_interval()) / effective_speed_factor(timer);
+}
+
+bool AdaptiveInterval::set_period(double period) {
+    period = std::clamp(period, parameters.min_period, parameters.max_period);
+
+    const auto factor = timeval_to_double(timer.get_interval()) / period;
+    if (!std::islessgreater(factor, effective_speed_factor(timer))) return false;
+
+    timer.set_speed_factor(factor);
+    return true;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_coarse_clock.hpp"
+
+#include "time_util.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <stdexcept>
+
+namespace cxxitimer {
+
+namespace {
+
+//* cached time (occupies a complete cache line to prevent false sharing)
+struct alignas(64) CachedTime {
+    std::atomic<std::int64_t> nsec {0};
+};
+
+CachedTime cached_time;
+
+}  // namespace
+
+bool CoarseClock::instance_exists = false;
+
+CoarseClock::CoarseClock(const ITimer_Real &timer) {
+    // prevent multiple instances
+    if (instance_exists) throw std::logic_error("instance exists");
+
+    update();
+    attach(timer);
+    instance_exists = true;
+}
+
+CoarseClock::~CoarseClock() {
+    detach();
+
+    // now() returns the epoch without instance
+    cached_time.nsec.store(0, std::memory_order_relaxed);
+
+    // allow new instance
+    instance_exists = false;
+}
+
+CoarseClock::time_point CoarseClock::now() noexcept {
+    const auto nsec = std::chrono::nanoseconds(cached_time.nsec.load(std::memory_order_relaxed));
+    return time_point(std::chrono::duration_cast<duration>(nsec));
+}
+
+timeval CoarseClock::now_timeval() noexcept {
+    const auto nsec = cached_time.nsec.load(std::memory_order_relaxed);
+    timeval    ret_val {};
+    ret_val.tv_sec  = nsec / NSEC_PER_SEC;
+    ret_val.tv_usec = nsec % NSEC_PER_SEC / NSEC_PER_USEC;
+    return ret_val;
+}
+
+void CoarseClock::update() noexcept {
+    cached_time.nsec.store(clock_nsec(CLOCK_REALTIME), std::memory_order_relaxed);
+}
+
+}  // namespace cxxitimer
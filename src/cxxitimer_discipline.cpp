@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_discipline.hpp"
+
+#include "cxxitimer_shared_tick.hpp"
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace cxxitimer {
+
+SpeedDiscipline::SpeedDiscipline(ITimer &_timer, reference_source_t _reference, const Parameters &_parameters)
+    : timer(_timer),
+      reference(std::move(_reference)),
+      parameters(_parameters),
+      nominal_speed(_timer.get_speed_factor()),
+      period_nsec(timeval_to_double(_timer.get_interval()) * NSEC_PER_SEC / nominal_speed) {
+    if (!reference) throw std::invalid_argument("no reference time source");
+
+    if (parameters.proportional_gain < 0.0 || parameters.integral_gain < 0.0)
+        throw std::invalid_argument("negative gain not allowed");
+
+    if (parameters.max_deviation < 0.0 || parameters.max_deviation >= 1.0)
+        throw std::invalid_argument("max deviation must be in [0;1[");
+
+    if (parameters.max_slew <= 0.0) throw std::invalid_argument("max slew must be positive");
+
+    if (period_nsec <= 0.0) throw std::invalid_argument("timer interval must be positive");
+}
+
+SpeedDiscipline::SpeedDiscipline(ITimer &_timer, reference_source_t _reference)
+    : SpeedDiscipline(_timer, std::move(_reference), Parameters()) {}
+
+bool SpeedDiscipline::update(std::uint32_t tick_count) {
+    const auto now = reference();
+    if (!now) return false;
+
+    if (!start_time) {
+        start_time = *now;
+        last_tick  = tick_count;
+        ticks      = 0;
+        return false;
+    }
+
+    // unsigned difference is correct across a wrap of the tick count
+    ticks += tick_count - last_tick;
+    last_tick = tick_count;
+
+    // phase error in periods (positive: expiration is late --> speed up)
+    const auto expected = static_cast<double>(*start_time) + static_cast<double>(ticks) * period_nsec;
+    const auto error    = (static_cast<double>(*now) - expected) / period_nsec;
+    phase_error         = error * period_nsec / NSEC_PER_SEC;
+
+    // PI controller (integral is bounded to prevent windup)
+    const auto limit      = parameters.max_deviation;
+    integral              = std::clamp(integral + parameters.integral_gain * error, -limit, limit);
+    const auto correction = std::clamp(parameters.proportional_gain * error + integral, -limit, limit);
+
+    // bounded slew
+    const auto current = timer.get_speed_factor();
+    const auto target  = std::clamp(nominal_speed * (1.0 + correction),
+                                   current * (1.0 - parameters.max_slew),
+                                   current * (1.0 + parameters.max_slew));
+
+    timer.set_speed_factor(target);
+    return true;
+}
+
+void SpeedDiscipline::reset() {
+    start_time.reset();
+    integral    = 0.0;
+    phase_error = 0.0;
+    timer.set_speed_factor(nominal_speed);
+}
+
+SpeedDiscipline::reference_source_t SpeedDiscipline::file_reference(std::string path) {
+    return [path = std::move(path)]() -> std::optional<std::int64_t> {
+        std::ifstream file(path);
+        std::int64_t  reference_time = 0;
+        if (!(file >> reference_time)) return std::nullopt;
+
+        std::int64_t taken_at = 0;
+        if (file >> taken_at) reference_time += monotonic_nsec() - taken_at;
+
+        return reference_time;
+    };
+}
+
+SpeedDiscipline::reference_source_t SpeedDiscipline::shared_tick_reference(const SharedTickReader &reader) {
+    return [&reader]() -> std::optional<std::int64_t> {
+        const auto snapshot = reader.read();
+        if (snapshot.ticks == 0) return std::nullopt;
+
+        return snapshot.realtime_nsec + (monotonic_nsec() - snapshot.monotonic_nsec);
+    };
+}
+
+}  // namespace cxxitimer
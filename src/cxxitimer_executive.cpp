@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_executive.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace cxxitimer {
+
+//* maximum number of slots per hyperperiod
+static constexpr std::size_t MAX_HYPERPERIOD = 1000000;
+
+RateExecutive::RateExecutive(const ITimer_Real &timer)
+    : base_period(timer.get_interval()), broadcast(timer), sequence(broadcast.get_sequence()) {}
+
+RateExecutive::~RateExecutive() = default;
+
+void RateExecutive::add_task(unsigned period, task_t task, unsigned offset) {
+    if (period == 0) throw std::invalid_argument("period must not be 0");
+    if (offset >= period) throw std::invalid_argument("offset must be less than period");
+
+    tasks.push_back(Task {std::move(task), period, offset});
+    slot_begin.clear();
+    slot_tasks.clear();
+}
+
+void RateExecutive::add_task(const timeval &period, task_t task) {
+    const auto base     = timeval_to_double(base_period);
+    const auto multiple = std::round(timeval_to_double(period) / base);
+
+    if (multiple < 1.0 || std::fabs(multiple * base - timeval_to_double(period)) > 1e-6)
+        throw std::invalid_argument("period is not a multiple of the base period");
+
+    add_task(static_cast<unsigned>(multiple), std::move(task));
+}
+
+void RateExecutive::build() {
+    if (tasks.empty()) throw std::logic_error("no tasks");
+
+    // rate monotonic order
+    std::stable_sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b) { return a.period < b.period; });
+
+    std::size_t hyperperiod = 1;
+    for (const auto &task : tasks) {
+        hyperperiod = std::lcm(hyperperiod, std::size_t {task.period});
+        if (hyperperiod > MAX_HYPERPERIOD) throw std::overflow_error("hyperperiod too large");
+    }
+
+    slot_begin.assign(hyperperiod + 1, 0);
+    slot_tasks.clear();
+    for (std::size_t s = 0; s < hyperperiod; ++s) {
+        slot_begin[s] = slot_tasks.size();
+        for (std::size_t t = 0; t < tasks.size(); ++t)
+            if (s % tasks[t].period == tasks[t].offset) slot_tasks.push_back(t);
+    }
+    slot_begin[hyperperiod] = slot_tasks.size();
+
+    // expirations before the build are not caught up
+    slot     = 0;
+    sequence = broadcast.get_sequence();
+}
+
+void RateExecutive::run_slot() {
+    if (slot_begin.empty()) throw std::logic_error("slot table not built");
+
+    for (auto i = slot_begin[slot]; i < slot_begin[slot + 1]; ++i)
+        tasks[slot_tasks[i]].task();
+
+    if (++slot == slot_begin.size() - 1) slot = 0;
+}
+
+std::uint32_t RateExecutive::wait_and_run() {
+    if (slot_begin.empty()) throw std::logic_error("slot table not built");
+
+    const auto current = broadcast.wait_for_tick(sequence);
+    const auto due     = current - sequence;
+    sequence           = current;
+
+    if (due > 1) overruns += due - 1;
+    for (std::uint32_t i = 0; i < due; ++i)
+        run_slot();
+
+    return due;
+}
+
+}  // namespace cxxitimer
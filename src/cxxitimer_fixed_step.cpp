@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_fixed_step.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace cxxitimer {
+
+FixedStepLoop::FixedStepLoop(const ITimer &_timer,
+                             double        _step_size,
+                             step_t        _step,
+                             render_t      _render,
+                             unsigned      _max_catch_up)
+    : timer(_timer),
+      step_size(_step_size),
+      step(std::move(_step)),
+      render(std::move(_render)),
+      max_catch_up(_max_catch_up),
+      broadcast(_timer),
+      sequence(broadcast.get_sequence()),
+      last_time(TscClock::now()) {
+    if (!(step_size > 0.0) || std::isinf(step_size)) throw std::invalid_argument("step size must be positive");
+    if (max_catch_up == 0) throw std::invalid_argument("max_catch_up must not be 0");
+    if (!step) throw std::invalid_argument("no step function");
+}
+
+FixedStepLoop::~FixedStepLoop() = default;
+
+unsigned FixedStepLoop::wait_and_run() {
+    sequence = broadcast.wait_for_tick(sequence);
+
+    const auto now     = TscClock::now();
+    const auto elapsed = std::chrono::duration<double>(now - last_time).count();
+    last_time          = now;
+
+    return advance(elapsed * timer.get_speed_factor());
+}
+
+unsigned FixedStepLoop::advance(double elapsed) {
+    if (elapsed > 0.0) accumulator += elapsed;
+
+    unsigned executed = 0;
+    while (accumulator >= step_size && executed < max_catch_up) {
+        step(step_size);
+        accumulator -= step_size;
+        simulation_time += step_size;
+        ++executed;
+    }
+    steps += executed;
+
+    // overload: drop the time that cannot be caught up
+    if (accumulator >= step_size) {
+        const auto keep = std::fmod(accumulator, step_size);
+        dropped_time += accumulator - keep;
+        accumulator = keep;
+    }
+
+    if (render) render(get_alpha());
+
+    return executed;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_heartbeat.hpp"
+
+#include "time_util.hpp"
+#include "unix_socket.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <ctime>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace cxxitimer {
+
+//* identifies heartbeat datagrams
+static constexpr std::uint32_t HEARTBEAT_MAGIC = 0x43584842;  // CXHB
+
+namespace {
+
+//* heartbeat datagram
+struct HeartbeatMessage {
+    std::uint32_t magic;
+    std::uint32_t id;
+    std::uint64_t sequence;
+    std::int64_t  send_nsec;  // CLOCK_MONOTONIC
+};
+
+int make_socket() {
+    const int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw std::system_error(errno, std::generic_category(), "call of socket failed");
+    return fd;
+}
+
+}  // namespace
+
+PhiAccrualDetector::PhiAccrualDetector(const Parameters &_parameters) : parameters(_parameters) {
+    if (parameters.window < 2) throw std::invalid_argument("window too small");
+    if (!(parameters.min_std_deviation > 0.0)) throw std::invalid_argument("invalid minimum standard deviation");
+    if (parameters.acceptable_pause < 0.0) throw std::invalid_argument("negative acceptable pause");
+    if (!(parameters.first_interval_estimate > 0.0)) throw std::invalid_argument("invalid first interval estimate");
+
+    intervals.reserve(parameters.window);
+}
+
+void PhiAccrualDetector::heartbeat(time_point time) {
+    if (heartbeat_count == 0) {
+        // bootstrap the distribution with the estimate
+        const double estimate = parameters.first_interval_estimate;
+        add_interval(estimate - estimate / 4.0);
+        add_interval(estimate + estimate / 4.0);
+    } else {
+        add_interval(std::chrono::duration<double>(time - last_heartbeat).count());
+    }
+
+    last_heartbeat = time;
+    ++heartbeat_count;
+}
+
+void PhiAccrualDetector::add_interval(double interval) noexcept {
+    if (intervals.size() < parameters.window) {
+        intervals.push_back(interval);
+    } else {
+        auto &oldest    = intervals[next];
+        sum            -= oldest;
+        sum_of_squares -= oldest * oldest;
+        oldest          = interval;
+        next            = (next + 1) % parameters.window;
+    }
+
+    sum            += interval;
+    sum_of_squares += interval * interval;
+}
+
+double PhiAccrualDetector::get_mean() const noexcept {
+    return intervals.empty() ? 0.0 : sum / static_cast<double>(intervals.size());
+}
+
+double PhiAccrualDetector::phi(time_point now) const noexcept {
+    if (heartbeat_count == 0) return 0.0;
+
+    const double n        = static_cast<double>(intervals.size());
+    const double mean     = sum / n;
+    const double variance = std::max(sum_of_squares / n - mean * mean, 0.0);
+    const double std_dev  = std::max(std::sqrt(variance), parameters.min_std_deviation);
+    const double elapsed  = std::chrono::duration<double>(now - last_heartbeat).count();
+    const double expected = mean + parameters.acceptable_pause;
+
+    // logistic approximation of the cumulative normal distribution
+    const double y = (elapsed - expected) / std_dev;
+    const double e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+    if (elapsed > expected) return -std::log10(e / (1.0 + e));
+    return -std::log10(1.0 - 1.0 / (1.0 + e));
+}
+
+HeartbeatSender::HeartbeatSender(const ITimer &timer, const std::string &path, std::uint32_t _id)
+    : fd(-1), address(make_unix_address(path)), id(_id) {
+    fd = make_socket();
+
+    try {
+        attach(timer);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+}
+
+HeartbeatSender::~HeartbeatSender() {
+    detach();
+    close(fd);
+}
+
+void HeartbeatSender::send() noexcept {
+    const HeartbeatMessage message {
+            HEARTBEAT_MAGIC, id, sequence.fetch_add(1, std::memory_order_relaxed) + 1, monotonic_nsec()};
+    sendto(fd,
+           &message,
+           sizeof(message),
+           MSG_DONTWAIT | MSG_NOSIGNAL,
+           reinterpret_cast<const sockaddr *>(&address),
+           sizeof(address));
+}
+
+HeartbeatMonitor::HeartbeatMonitor(const ITimer      &timer,
+                                   std::string        _path,
+                                   callback_t         _callback,
+                                   const Parameters &_parameters)
+    : path(std::move(_path)),
+      fd(-1),
+      socket_dev(0),
+      socket_ino(0),
+      parameters(_parameters),
+      callback(std::move(_callback)),
+      broadcast(timer),
+      tick_sequence(broadcast.get_sequence()) {
+    if (!(parameters.threshold > 0.0)) throw std::invalid_argument("threshold must be positive");
+    PhiAccrualDetector check_parameters(parameters.detector);  // validate detector parameters
+
+    fd = bind_unix_socket(path, SOCK_DGRAM, socket_dev, socket_ino);
+}
+
+HeartbeatMonitor::HeartbeatMonitor(const ITimer &timer, std::string path, callback_t callback)
+    : HeartbeatMonitor(timer, std::move(path), std::move(callback), Parameters()) {}
+
+HeartbeatMonitor::~HeartbeatMonitor() {
+    close(fd);
+    unlink_unix_socket(path, socket_dev, socket_ino);
+}
+
+std::size_t HeartbeatMonitor::receive() {
+    std::size_t      received = 0;
+    HeartbeatMessage message {};
+
+    while (true) {
+        const auto size = recv(fd, &message, sizeof(message), MSG_DONTWAIT);
+        if (size < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN) break;
+            throw std::system_error(errno, std::generic_category(), "call of recv failed");
+        }
+
+        if (static_cast<std::size_t>(size) != sizeof(message) || message.magic != HEARTBEAT_MAGIC) continue;
+
+        auto it = members.find(message.id);
+        if (it == members.end())
+            it = members.emplace(message.id, Member {PhiAccrualDetector(parameters.detector), false}).first;
+
+        // sender and monitor share CLOCK_MONOTONIC (same host)
+        const PhiAccrualDetector::time_point send_time(message.send_nsec);
+
+        // ignore reordered or duplicated heartbeats
+        auto &detector = it->second.detector;
+        if (detector.get_heartbeat_count() != 0 && send_time <= detector.get_last_heartbeat()) continue;
+
+        detector.heartbeat(send_time);
+        ++received;
+    }
+
+    return received;
+}
+
+void HeartbeatMonitor::check() {
+    const PhiAccrualDetector::time_point now(monotonic_nsec());
+
+    // collect state changes first (the callback might remove senders)
+    std::vector<std::pair<std::uint32_t, bool>> changes;
+    for (auto &[id, member] : members) {
+        const bool suspected = member.detector.phi(now) > parameters.threshold;
+        if (suspected != member.suspected) {
+            member.suspected = suspected;
+            changes.emplace_back(id, suspected);
+        }
+    }
+
+    if (callback)
+        for (const auto &[id, suspected] : changes)
+            callback(id, suspected);
+}
+
+void HeartbeatMonitor::wait_and_check() {
+    tick_sequence = broadcast.wait_for_tick(tick_sequence);
+    receive();
+    check();
+}
+
+double HeartbeatMonitor::get_phi(std::uint32_t id) const {
+    return members.at(id).detector.phi(PhiAccrualDetector::time_point(monotonic_nsec()));
+}
+
+bool HeartbeatMonitor::is_suspected(std::uint32_t id) const {
+    return members.at(id).suspected;
+}
+
+bool HeartbeatMonitor::remove(std::uint32_t id) noexcept {
+    return members.erase(id) != 0;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_introspection.hpp"
+
+#include "time_util.hpp"
+#include "unix_socket.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace cxxitimer {
+
+//* gaps of more expirations reset the phase instead of being counted as missed (e.g. timer restarted)
+static constexpr std::int64_t MAX_MISSED = 1000;
+
+namespace {
+
+const char *type_name(int type) noexcept {
+    switch (type) {
+        case ITIMER_REAL: return "REAL";
+        case ITIMER_VIRTUAL: return "VIRTUAL";
+        case ITIMER_PROF: return "PROF";
+        default: return "UNKNOWN";
+    }
+}
+
+void check_name(const std::string &name) {
+    const auto is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+    if (name.empty() || std::any_of(name.begin(), name.end(), is_space)) throw std::invalid_argument("invalid name");
+}
+
+}  // namespace
+
+TimerStats::TimerStats(const ITimer &_timer) : timer(_timer) {
+    update_period();
+    attach(timer);
+}
+
+TimerStats::~TimerStats() {
+    detach();
+}
+
+void TimerStats::update_period() noexcept {
+    // the interval of the kernel timer: interval / speed factor is truncated to usec (the error would add up)
+    std::int64_t new_period = 0;
+    if (timer.get_type() == ITIMER_REAL) {
+        itimerval value {};
+        if (!timer.is_running() || getitimer(ITIMER_REAL, &value))
+            value.it_interval = timer.get_interval() / timer.get_speed_factor();
+        new_period = std::int64_t {value.it_interval.tv_sec} * NSEC_PER_SEC +
+                     std::int64_t {value.it_interval.tv_usec} * NSEC_PER_USEC;
+    }
+
+    if (period.exchange(new_period) != new_period || !timer.is_running()) expected.store(0);
+}
+
+TimerStats::histogram_t TimerStats::get_lateness() const noexcept {
+    histogram_t result {};
+    for (std::size_t i = 0; i < LATENESS_BUCKETS; ++i)
+        result[i] = lateness[i].load(std::memory_order_relaxed);
+    return result;
+}
+
+void TimerStats::on_tick(void *) noexcept {
+    expirations.fetch_add(1, std::memory_order_relaxed);
+
+    const auto current = period.load(std::memory_order_relaxed);
+    if (current <= 0) return;
+
+    const auto now  = monotonic_nsec();
+    auto       next = expected.load(std::memory_order_relaxed);
+
+    // the first tick defines the phase
+    if (next == 0) {
+        expected.store(now + current, std::memory_order_relaxed);
+        return;
+    }
+
+    // the phase changed (e.g. timer restarted): the tick defines the new phase
+    std::int64_t late = now - next;
+    if (late <= -current || late / current > MAX_MISSED) {
+        expected.store(now + current, std::memory_order_relaxed);
+        if (late < 0) lateness[0].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // an early tick is counted as on time and keeps the phase
+    late = std::max<std::int64_t>(late, 0);
+
+    // expirations skipped completely
+    const auto skipped = late / current;
+    if (skipped > 0) {
+        missed.fetch_add(static_cast<std::uint64_t>(skipped), std::memory_order_relaxed);
+        late -= skipped * current;
+        next += skipped * current;
+    }
+    expected.store(next + current, std::memory_order_relaxed);
+
+    std::size_t bucket = 0;
+    for (auto usec = late / NSEC_PER_USEC; usec > 0 && bucket < LATENESS_BUCKETS - 1; usec >>= 1)
+        ++bucket;
+    lateness[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+IntrospectionServer::IntrospectionServer(std::string _path)
+    : path(std::move(_path)), fd(bind_unix_socket(path, SOCK_STREAM, socket_dev, socket_ino)) {
+    if (listen(fd, SOMAXCONN)) {
+        const int error = errno;
+        close(fd);
+        unlink_unix_socket(path, socket_dev, socket_ino);
+        throw std::system_error(error, std::generic_category(), "call of listen failed");
+    }
+}
+
+IntrospectionServer::~IntrospectionServer() {
+    close(fd);
+    unlink_unix_socket(path, socket_dev, socket_ino);
+}
+
+void IntrospectionServer::add_timer(const std::string &name, const ITimer &timer) {
+    check_name(name);
+    timers.push_back(TimerEntry {name, std::make_unique<TimerStats>(timer)});
+}
+
+void IntrospectionServer::add_queue(const std::string &name, const QueueDispatcher &dispatcher) {
+    check_name(name);
+    queues.push_back(QueueEntry {name, dispatcher});
+}
+
+std::size_t IntrospectionServer::poll() {
+    std::size_t served = 0;
+    std::string text;
+
+    while (true) {
+        const int client = accept4(fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno == EAGAIN) break;
+            throw std::system_error(errno, std::generic_category(), "call of accept failed");
+        }
+
+        // one report for all clients of this call
+        if (served == 0) text = report();
+
+        // clients that do not read fast enough get a truncated report
+        std::size_t sent = 0;
+        while (sent < text.size()) {
+            const auto tmp = send(client, text.data() + sent, text.size() - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (tmp < 0 && errno == EINTR) continue;
+            if (tmp <= 0) break;
+            sent += static_cast<std::size_t>(tmp);
+        }
+
+        close(client);
+        ++served;
+    }
+
+    return served;
+}
+
+std::string IntrospectionServer::report() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(6);
+
+    for (const auto &entry : timers) {
+        auto       &stats = *entry.stats;
+        const auto &timer = stats.get_timer();
+        stats.update_period();
+
+        std::error_code ec;
+        const auto      value = timer.get_timer_value(ec);
+
+        out << "timer " << entry.name << " type=" << type_name(timer.get_type()) << " running=" << timer.is_running()
+            << " interval=" << timeval_to_double(timer.get_interval())
+            << " value=" << (ec ? -1.0 : timeval_to_double(value)) << " speed_factor=" << timer.get_speed_factor()
+            << " expirations=" << stats.get_expirations() << " missed=" << stats.get_missed() << '\n';
+
+        if (timer.get_type() != ITIMER_REAL) continue;
+
+        const auto histogram = stats.get_lateness();
+        out << "lateness " << entry.name;
+        for (std::size_t i = 0; i < histogram.size(); ++i) {
+            if (i < histogram.size() - 1) out << " <" << (1U << i) << "us=" << histogram[i];
+            else
+                out << " >=" << (1U << (i - 1)) << "us=" << histogram[i];
+        }
+        out << '\n';
+    }
+
+    for (const auto &entry : queues)
+        out << "queue " << entry.name << " size=" << entry.dispatcher.size() << '\n';
+
+    return out.str();
+}
+
+}  // namespace cxxitimer
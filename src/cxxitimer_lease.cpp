@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_lease.hpp"
+
+#include <utility>
+
+namespace cxxitimer {
+
+LeaseManager::LeaseManager(QueueDispatcher &_dispatcher, expiry_callback_t _callback)
+    : dispatcher(_dispatcher), callback(std::move(_callback)) {}
+
+LeaseManager::~LeaseManager() {
+    std::lock_guard lock(mutex);
+
+    for (const auto &[id, entry] : leases)
+        dispatcher.cancel(entry.timer);
+}
+
+std::optional<LeaseManager::lease_id>
+        LeaseManager::acquire(const std::string &resource, holder_id holder, std::chrono::nanoseconds duration) {
+    const auto expires_at = dispatcher.now() + duration;
+
+    std::lock_guard lock(mutex);
+
+    auto it = resources.find(resource);
+    if (it != resources.end()) {
+        auto &lease = leases.at(it->second).lease;
+        if (lease.holder != holder) return std::nullopt;
+
+        // renew
+        if (expires_at > lease.expires_at) lease.expires_at = expires_at;
+        return lease.id;
+    }
+
+    const auto id    = ++last_id;
+    auto      &entry = leases.emplace(id, Entry {Lease {id, resource, holder, expires_at}, TimerQueue::INVALID_ID})
+                          .first->second;
+
+    try {
+        schedule(entry);
+        resources.emplace(resource, id);
+    } catch (...) {
+        leases.erase(id);
+        throw;
+    }
+
+    return id;
+}
+
+bool LeaseManager::renew(lease_id id, std::chrono::nanoseconds duration) {
+    const auto expires_at = dispatcher.now() + duration;
+
+    std::lock_guard lock(mutex);
+
+    auto it = leases.find(id);
+    if (it == leases.end()) return false;
+
+    auto &entry = it->second;
+
+    // a later expiration is checked when the timer expires, an earlier one needs an earlier timer
+    // (if the timer already expired, its pending callback checks the new expiration)
+    if (expires_at < entry.lease.expires_at) dispatcher.reschedule(entry.timer, expires_at);
+    entry.lease.expires_at = expires_at;
+    return true;
+}
+
+bool LeaseManager::release(lease_id id) {
+    std::lock_guard lock(mutex);
+
+    auto it = leases.find(id);
+    if (it == leases.end()) return false;
+
+    dispatcher.cancel(it->second.timer);
+    resources.erase(it->second.lease.resource);
+    leases.erase(it);
+    return true;
+}
+
+std::optional<LeaseManager::Lease> LeaseManager::get_lease(const std::string &resource) const {
+    std::lock_guard lock(mutex);
+
+    auto it = resources.find(resource);
+    if (it == resources.end()) return std::nullopt;
+    return leases.at(it->second).lease;
+}
+
+std::size_t LeaseManager::size() const {
+    std::lock_guard lock(mutex);
+    return leases.size();
+}
+
+std::size_t LeaseManager::flush() {
+    std::vector<Lease> batch;
+
+    {
+        std::lock_guard lock(mutex);
+        batch.swap(expired);
+    }
+
+    // report without holding the lock (the callback may acquire leases)
+    if (!batch.empty() && callback) callback(batch);
+    return batch.size();
+}
+
+std::size_t LeaseManager::wait_and_dispatch() {
+    dispatcher.wait_and_dispatch();
+    return flush();
+}
+
+void LeaseManager::schedule(Entry &entry) {
+    const auto id = entry.lease.id;
+    entry.timer   = dispatcher.schedule_at(entry.lease.expires_at, [this, id] { on_timer(id); });
+}
+
+void LeaseManager::on_timer(lease_id id) {
+    std::lock_guard lock(mutex);
+
+    auto it = leases.find(id);
+    if (it == leases.end()) return;
+
+    auto &entry = it->second;
+    if (entry.lease.expires_at > dispatcher.now()) {
+        // renewed
+        schedule(entry);
+        return;
+    }
+
+    resources.erase(entry.lease.resource);
+    expired.push_back(std::move(entry.lease));
+    leases.erase(it);
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_metrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace cxxitimer {
+
+namespace {
+
+//* bit mask with the nbits least significant bits set
+constexpr std::uint64_t mask(unsigned nbits) noexcept {
+    return nbits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << nbits) - 1;
+}
+
+//* sign extend a nbits wide value
+constexpr std::int64_t sign_extend(std::uint64_t value, unsigned nbits) noexcept {
+    return static_cast<std::int64_t>(value << (64 - nbits)) >> (64 - nbits);
+}
+
+//* reads a bit stream
+class BitReader {
+private:
+    const std::vector<std::uint64_t> &bits;
+    std::size_t                       pos = 0;
+
+public:
+    explicit BitReader(const std::vector<std::uint64_t> &bits) noexcept : bits(bits) {}
+
+    std::uint64_t read(unsigned nbits) noexcept {
+        std::uint64_t result = 0;
+        while (nbits > 0) {
+            const auto     word  = bits[pos / 64];
+            const unsigned space = 64 - static_cast<unsigned>(pos % 64);
+            const unsigned n     = std::min(space, nbits);
+            const auto     chunk = (word >> (space - n)) & mask(n);
+
+            result  = n == 64 ? chunk : (result << n) | chunk;
+            nbits  -= n;
+            pos    += n;
+        }
+        return result;
+    }
+
+    std::int64_t read_dod() noexcept {
+        if (read(1) == 0) return 0;
+        if (read(1) == 0) return sign_extend(read(7), 7);
+        if (read(1) == 0) return sign_extend(read(9), 9);
+        if (read(1) == 0) return sign_extend(read(12), 12);
+        return static_cast<std::int64_t>(read(64));
+    }
+};
+
+}  // namespace
+
+void TimeSeries::Block::write(std::uint64_t value, unsigned nbits) {
+    while (nbits > 0) {
+        const unsigned offset = static_cast<unsigned>(bit_count % 64);
+        if (offset == 0) bits.push_back(0);
+
+        const unsigned space = 64 - offset;
+        const unsigned n     = std::min(space, nbits);
+
+        bits.back() |= ((value >> (nbits - n)) & mask(n)) << (space - n);
+        nbits       -= n;
+        bit_count   += n;
+    }
+}
+
+void TimeSeries::append(time_point timestamp, double value) {
+    const std::int64_t ts         = timestamp.count();
+    const auto         value_bits = std::bit_cast<std::uint64_t>(value);
+
+    if (!blocks.empty() && ts < blocks.back().last_timestamp)
+        throw std::invalid_argument("timestamp older than the last sample");
+
+    if (blocks.empty() || blocks.back().count == SAMPLES_PER_BLOCK) {
+        // first sample of a block: store uncompressed
+        auto &block = blocks.emplace_back();
+        block.write(static_cast<std::uint64_t>(ts), 64);
+        block.write(value_bits, 64);
+        block.first_timestamp = ts;
+        block.last_timestamp  = ts;
+        block.last_value      = value_bits;
+        block.count           = 1;
+    } else {
+        auto &block = blocks.back();
+
+        // timestamp: delta of delta
+        const std::int64_t delta = ts - block.last_timestamp;
+        const std::int64_t dod   = delta - block.last_delta;
+        const auto         raw   = static_cast<std::uint64_t>(dod);
+        if (dod == 0) {
+            block.write(0b0, 1);
+        } else if (dod >= -64 && dod <= 63) {
+            block.write(0b10, 2);
+            block.write(raw, 7);
+        } else if (dod >= -256 && dod <= 255) {
+            block.write(0b110, 3);
+            block.write(raw, 9);
+        } else if (dod >= -2048 && dod <= 2047) {
+            block.write(0b1110, 4);
+            block.write(raw, 12);
+        } else {
+            block.write(0b1111, 4);
+            block.write(raw, 64);
+        }
+
+        // value: XOR with the previous value
+        const std::uint64_t x = value_bits ^ block.last_value;
+        if (x == 0) {
+            block.write(0b0, 1);
+        } else {
+            const unsigned leading  = std::min(static_cast<unsigned>(std::countl_zero(x)), 31u);
+            const unsigned trailing = static_cast<unsigned>(std::countr_zero(x));
+
+            if (block.trailing != 64 && leading >= block.leading && trailing >= block.trailing) {
+                // meaningful bits fit into the previous window
+                block.write(0b10, 2);
+                block.write(x >> block.trailing, 64 - block.leading - block.trailing);
+            } else {
+                const unsigned meaningful = 64 - leading - trailing;
+                block.write(0b11, 2);
+                block.write(leading, 5);
+                block.write(meaningful - 1, 6);
+                block.write(x >> trailing, meaningful);
+                block.leading  = leading;
+                block.trailing = trailing;
+            }
+        }
+
+        block.last_timestamp = ts;
+        block.last_delta     = delta;
+        block.last_value     = value_bits;
+        ++block.count;
+    }
+
+    ++sample_count;
+
+    // discard oldest blocks
+    while (max_samples != 0 && blocks.size() > 1 && sample_count - blocks.front().count >= max_samples) {
+        sample_count -= blocks.front().count;
+        blocks.pop_front();
+    }
+}
+
+std::vector<TimeSeries::Sample> TimeSeries::query(time_point from, time_point to) const {
+    std::vector<Sample> result;
+
+    for (const auto &block : blocks) {
+        if (block.last_timestamp < from.count()) continue;
+        if (block.first_timestamp > to.count()) break;
+
+        BitReader     reader(block.bits);
+        auto          ts         = static_cast<std::int64_t>(reader.read(64));
+        std::uint64_t value_bits = reader.read(64);
+        std::int64_t  delta      = 0;
+        unsigned      leading    = 0;
+        unsigned      trailing   = 0;
+
+        for (std::size_t i = 0; i < block.count; ++i) {
+            if (i != 0) {
+                delta += reader.read_dod();
+                ts    += delta;
+
+                if (reader.read(1) != 0) {
+                    if (reader.read(1) != 0) {
+                        leading                   = static_cast<unsigned>(reader.read(5));
+                        const unsigned meaningful = static_cast<unsigned>(reader.read(6)) + 1;
+                        trailing                  = 64 - leading - meaningful;
+                    }
+                    value_bits ^= reader.read(64 - leading - trailing) << trailing;
+                }
+            }
+
+            if (ts > to.count()) break;
+            if (ts >= from.count()) result.push_back(Sample {time_point(ts), std::bit_cast<double>(value_bits)});
+        }
+    }
+
+    return result;
+}
+
+std::size_t TimeSeries::get_compressed_size() const noexcept {
+    std::size_t size = 0;
+    for (const auto &block : blocks)
+        size += (block.bit_count + 7) / 8;
+    return size;
+}
+
+MetricSampler::MetricSampler(const ITimer &timer, std::size_t _max_samples)
+    : max_samples(_max_samples), broadcast(timer), sequence(broadcast.get_sequence()) {}
+
+MetricSampler::~MetricSampler() = default;
+
+void MetricSampler::add_counter(const std::string &name, const std::atomic<std::uint64_t> &counter) {
+    add_metric(name, [&counter] { return static_cast<double>(counter.load(std::memory_order_relaxed)); });
+}
+
+void MetricSampler::add_gauge(const std::string &name, const std::atomic<double> &gauge) {
+    add_metric(name, [&gauge] { return gauge.load(std::memory_order_relaxed); });
+}
+
+void MetricSampler::add_gauge(const std::string &name, gauge_t gauge) {
+    add_metric(name, std::move(gauge));
+}
+
+void MetricSampler::add_metric(const std::string &name, gauge_t read) {
+    std::lock_guard lock(mutex);
+
+    if (std::any_of(metrics.begin(), metrics.end(), [&name](const Metric &metric) { return metric.name == name; }))
+        throw std::invalid_argument("metric already exists");
+
+    metrics.push_back(Metric {name, std::move(read), TimeSeries(max_samples)});
+}
+
+void MetricSampler::sample(time_point timestamp) {
+    std::lock_guard lock(mutex);
+
+    if (timestamp < last_timestamp) throw std::invalid_argument("timestamp older than the last samples");
+    append_samples(timestamp);
+}
+
+void MetricSampler::sample() {
+    const auto now = std::chrono::duration_cast<time_point>(std::chrono::system_clock::now().time_since_epoch());
+
+    std::lock_guard lock(mutex);
+
+    // the system time might be set backwards
+    append_samples(std::max(now, last_timestamp));
+}
+
+void MetricSampler::append_samples(time_point timestamp) {
+    last_timestamp = timestamp;
+
+    for (auto &metric : metrics)
+        metric.series.append(timestamp, metric.read());
+}
+
+void MetricSampler::wait_and_sample() {
+    sequence = broadcast.wait_for_tick(sequence);
+    sample();
+}
+
+std::vector<TimeSeries::Sample> MetricSampler::query(const std::string &name, time_point from, time_point to) const {
+    std::lock_guard lock(mutex);
+
+    for (const auto &metric : metrics)
+        if (metric.name == name) return metric.series.query(from, to);
+
+    throw std::out_of_range("no such metric");
+}
+
+std::vector<std::string> MetricSampler::get_names() const {
+    std::lock_guard lock(mutex);
+
+    std::vector<std::string> names;
+    names.reserve(metrics.size());
+    for (const auto &metric : metrics)
+        names.push_back(metric.name);
+    return names;
+}
+
+std::size_t MetricSampler::get_compressed_size() const noexcept {
+    std::lock_guard lock(mutex);
+
+    std::size_t size = 0;
+    for (const auto &metric : metrics)
+        size += metric.series.get_compressed_size();
+    return size;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_profile_dump.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace cxxitimer {
+
+//* identifies a profile dump (format version 1, native byte order)
+static constexpr char DUMP_MAGIC[8] = {'C', 'X', 'P', 'R', 'O', 'F', '\0', '\1'};
+
+namespace {
+
+template <typename T>
+void write_value(std::ostream &out, const T &value) {
+    out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void write_string(std::ostream &out, const std::string &str) {
+    write_value<std::uint64_t>(out, str.size());
+    out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+template <typename T>
+T read_value(std::istream &in) {
+    T value {};
+    if (!in.read(reinterpret_cast<char *>(&value), sizeof(value))) throw std::runtime_error("truncated profile dump");
+    return value;
+}
+
+std::string read_string(std::istream &in) {
+    const auto  size = read_value<std::uint64_t>(in);
+    std::string str(size, '\0');
+    if (!in.read(str.data(), static_cast<std::streamsize>(size))) throw std::runtime_error("truncated profile dump");
+    return str;
+}
+
+}  // namespace
+
+void write_profile_dump(std::ostream &out, const std::vector<ProfileSample> &samples) {
+    std::ifstream maps_file("/proc/self/maps");
+    if (!maps_file) throw std::system_error(errno, std::generic_category(), "failed to open /proc/self/maps");
+    std::ostringstream maps;
+    maps << maps_file.rdbuf();
+
+    out.write(DUMP_MAGIC, sizeof(DUMP_MAGIC));
+    write_string(out, maps.str());
+
+    std::set<label_id> labels;
+    write_value<std::uint64_t>(out, samples.size());
+    for (const auto &sample : samples) {
+        write_value(out, sample.timestamp);
+        write_value(out, sample.period);
+        write_value<std::int32_t>(out, sample.thread);
+        write_value(out, sample.depth);
+        for (std::size_t i = 0; i < sample.depth; ++i)
+            write_value<std::uint64_t>(out, reinterpret_cast<std::uintptr_t>(sample.stack[i]));
+        write_value(out, sample.label_count);
+        for (std::size_t i = 0; i < sample.label_count; ++i) {
+            write_value(out, sample.labels[i]);
+            labels.insert(sample.labels[i]);
+        }
+    }
+
+    write_value<std::uint64_t>(out, labels.size());
+    for (const auto id : labels) {
+        const auto label = Profiler::get_label(id);
+        write_value(out, id);
+        write_string(out, label.first);
+        write_string(out, label.second);
+    }
+
+    if (!out) throw std::runtime_error("failed to write profile dump");
+}
+
+ProfileDump read_profile_dump(std::istream &in) {
+    char magic[sizeof(DUMP_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, DUMP_MAGIC, sizeof(magic)) != 0)
+        throw std::runtime_error("not a profile dump");
+
+    ProfileDump dump;
+    dump.maps = read_string(in);
+
+    const auto count = read_value<std::uint64_t>(in);
+    dump.samples.reserve(count);
+    for (std::uint64_t n = 0; n < count; ++n) {
+        ProfileSample sample {};
+        sample.timestamp = read_value<std::int64_t>(in);
+        sample.period    = read_value<std::int64_t>(in);
+        sample.thread    = read_value<std::int32_t>(in);
+        sample.depth     = read_value<std::uint32_t>(in);
+        if (sample.depth > ProfileSample::MAX_DEPTH) throw std::runtime_error("invalid stack depth");
+        for (std::size_t i = 0; i < sample.depth; ++i) {
+            const std::uintptr_t address = read_value<std::uint64_t>(in);
+            sample.stack[i]              = reinterpret_cast<void *>(address);
+        }
+
+        sample.label_count = read_value<std::uint32_t>(in);
+        if (sample.label_count > ProfileSample::MAX_LABELS) throw std::runtime_error("invalid label count");
+        for (std::size_t i = 0; i < sample.label_count; ++i)
+            sample.labels[i] = read_value<label_id>(in);
+
+        dump.samples.push_back(sample);
+    }
+
+    const auto label_count = read_value<std::uint64_t>(in);
+    for (std::uint64_t n = 0; n < label_count; ++n) {
+        const auto id    = read_value<label_id>(in);
+        auto       key   = read_string(in);
+        auto       value = read_string(in);
+        dump.labels.emplace(id, std::make_pair(std::move(key), std::move(value)));
+    }
+
+    return dump;
+}
+
+}  // namespace cxxitimer
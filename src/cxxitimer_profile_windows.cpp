@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_profile_windows.hpp"
+
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace cxxitimer {
+
+ProfileWindows::ProfileWindows(std::chrono::nanoseconds _length, std::size_t _max_windows)
+    : length(_length.count()), max_windows(_max_windows) {
+    if (length <= 0) throw std::invalid_argument("window length must be positive");
+    if (max_windows == 0) throw std::invalid_argument("max_windows must not be 0");
+}
+
+void ProfileWindows::add(const ProfileSample &sample) {
+    rotate(sample.timestamp);
+
+    auto      &window = windows.back();
+    const auto id     = intern_stack(sample);
+
+    auto [it, inserted] = window.cpu_time.try_emplace(id, 0);
+    if (inserted) ++stacks.at(id).references;
+
+    it->second   += sample.period;
+    window.total += sample.period;
+}
+
+void ProfileWindows::add(const std::vector<ProfileSample> &samples) {
+    for (const auto &sample : samples)
+        add(sample);
+}
+
+void ProfileWindows::rotate(std::int64_t now) {
+    const std::int64_t start = now - now % length;
+
+    if (windows.empty()) {
+        push_window(start);
+        return;
+    }
+
+    if (start <= windows.back().start) return;
+
+    // skip windows that would be discarded anyway
+    const auto max_span = static_cast<std::int64_t>(max_windows) * length;
+    auto       next     = std::max(windows.back().start + length, start - max_span + length);
+    for (; next <= start; next += length)
+        push_window(next);
+}
+
+const ProfileWindows::Window &ProfileWindows::get_window(std::size_t age) const {
+    if (age >= windows.size()) throw std::out_of_range("no such window");
+    return windows[windows.size() - 1 - age];
+}
+
+const std::vector<void *> &ProfileWindows::get_stack(stack_id id) const {
+    return stacks.at(id).entry->first;
+}
+
+std::vector<ProfileWindows::DiffEntry> ProfileWindows::diff(std::size_t base_age, std::size_t age) const {
+    const auto &base    = get_window(base_age);
+    const auto &current = get_window(age);
+
+    const auto fraction = [](std::int64_t cpu, std::int64_t total) {
+        return total > 0 ? static_cast<double>(cpu) / static_cast<double>(total) : 0.0;
+    };
+
+    std::vector<DiffEntry> result;
+    result.reserve(base.cpu_time.size() + current.cpu_time.size());
+
+    for (const auto &[id, cpu] : current.cpu_time) {
+        const auto         it       = base.cpu_time.find(id);
+        const std::int64_t base_cpu = it != base.cpu_time.end() ? it->second : 0;
+        result.push_back(DiffEntry {id,
+                                    static_cast<double>(base_cpu) / NSEC_PER_SEC,
+                                    static_cast<double>(cpu) / NSEC_PER_SEC,
+                                    fraction(cpu, current.total) - fraction(base_cpu, base.total)});
+    }
+
+    for (const auto &[id, base_cpu] : base.cpu_time) {
+        if (current.cpu_time.count(id)) continue;
+        result.push_back(
+                DiffEntry {id, static_cast<double>(base_cpu) / NSEC_PER_SEC, 0.0, -fraction(base_cpu, base.total)});
+    }
+
+    std::sort(result.begin(), result.end(), [](const DiffEntry &a, const DiffEntry &b) {
+        return std::fabs(a.delta) > std::fabs(b.delta);
+    });
+
+    return result;
+}
+
+stack_id ProfileWindows::hash_stack(void *const *frames, std::size_t depth) noexcept {
+    // FNV-1a over the frame addresses
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < depth; ++i) {
+        hash ^= reinterpret_cast<std::uintptr_t>(frames[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    // final mix (the low bits of the addresses carry little entropy)
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+stack_id ProfileWindows::intern_stack(const ProfileSample &sample) {
+    // known stacks are found by their frames (the id of a stack does not depend on other stacks)
+    auto [entry, inserted] = stack_index.try_emplace(std::vector<void *>(sample.stack, sample.stack + sample.depth));
+    if (!inserted) return entry->second;
+
+    // new stack: hash as id, next free id on hash collisions
+    auto id = hash_stack(sample.stack, sample.depth);
+    while (stacks.count(id))
+        ++id;
+
+    entry->second = id;
+    stacks.emplace(id, Stack {entry, 0});
+    return id;
+}
+
+void ProfileWindows::push_window(std::int64_t start) {
+    windows.push_back(Window {start, {}, 0});
+
+    while (windows.size() > max_windows) {
+        for (const auto &entry : windows.front().cpu_time) {
+            auto it = stacks.find(entry.first);
+            if (--it->second.references == 0) {
+                stack_index.erase(it->second.entry);
+                stacks.erase(it);
+            }
+        }
+        windows.pop_front();
+    }
+}
+
+}  // namespace cxxitimer
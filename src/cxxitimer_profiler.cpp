@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_profiler.hpp"
+
+#include "cxxitimer_tsc.hpp"
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <deque>
+#include <execinfo.h>
+#include <mutex>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace cxxitimer {
+
+namespace {
+
+//* labels of a thread
+struct LabelStack {
+    //* number of pushed labels (may exceed MAX_LABELS)
+    std::uint32_t depth;
+
+    //* outermost labels
+    label_id labels[ProfileSample::MAX_LABELS];
+};
+
+// initial exec TLS model: accessing the label stack from the signal handler must not allocate
+[[gnu::tls_model("initial-exec")]] thread_local LabelStack label_stack;
+
+//* interned labels
+struct LabelTable {
+    std::mutex                                       mutex;
+    std::deque<std::pair<std::string, std::string>> labels;
+    std::unordered_map<std::string, label_id>        index;
+};
+
+LabelTable &label_table() {
+    static LabelTable table;
+    return table;
+}
+
+//* address of the interrupted instruction
+void *get_pc(void *context) noexcept {
+    if (!context) return nullptr;
+    [[maybe_unused]] const auto *uc = static_cast<const ucontext_t *>(context);
+#if defined(__x86_64__)
+    return reinterpret_cast<void *>(uc->uc_mcontext.gregs[REG_RIP]);
+#elif defined(__i386__)
+    return reinterpret_cast<void *>(uc->uc_mcontext.gregs[REG_EIP]);
+#elif defined(__aarch64__)
+    return reinterpret_cast<void *>(uc->uc_mcontext.pc);
+#else
+    return nullptr;
+#endif
+}
+
+void push_label(label_id id) noexcept {
+    const auto depth = label_stack.depth;
+    if (depth < ProfileSample::MAX_LABELS) label_stack.labels[depth] = id;
+
+    // the label must be visible to the signal handler before the depth
+    std::atomic_signal_fence(std::memory_order_release);
+    label_stack.depth = depth + 1;
+}
+
+}  // namespace
+
+Profiler::Profiler(const ITimer_Prof &timer, std::size_t capacity) {
+    if (capacity == 0) throw std::invalid_argument("capacity must not be 0");
+
+    std::size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    slots = std::make_unique<Slot[]>(size);
+    mask  = size - 1;
+    for (std::size_t i = 0; i < size; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+
+    update_period(timer);
+
+    // the first call of backtrace loads libgcc (not async-signal-safe)
+    void *frame = nullptr;
+    backtrace(&frame, 1);
+
+    attach(timer);
+}
+
+Profiler::~Profiler() {
+    detach();
+}
+
+void Profiler::update_period(const ITimer &timer) noexcept {
+    const auto nsec = timeval_to_double(timer.get_interval()) / timer.get_speed_factor() * NSEC_PER_SEC;
+    period.store(static_cast<std::int64_t>(nsec), std::memory_order_relaxed);
+}
+
+void Profiler::record(void *context) noexcept {
+    const auto start = TscClock::now();
+    store_sample(context);
+    handler_time.fetch_add((TscClock::now() - start).count(), std::memory_order_relaxed);
+    invocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Profiler::store_sample(void *context) noexcept {
+    // claim a slot
+    auto  pos  = head.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot            = &slots[pos & mask];
+        const auto diff = static_cast<std::int64_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // ring buffer full
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    auto &sample = slot->sample;
+
+    sample.timestamp = monotonic_nsec();
+    sample.period    = period.load(std::memory_order_relaxed);
+    sample.thread    = static_cast<pid_t>(syscall(SYS_gettid));
+
+    // call stack: skip the frames of the signal handler
+    void      *frames[ProfileSample::MAX_DEPTH + 8];
+    const auto count = static_cast<std::size_t>(backtrace(frames, static_cast<int>(std::size(frames))));
+    void      *pc    = get_pc(context);
+
+    std::size_t first = 1;  // skip record()
+    if (pc) first = static_cast<std::size_t>(std::find(frames, frames + count, pc) - frames);
+
+    if (first < count) {
+        sample.depth = static_cast<std::uint32_t>(std::min(count - first, ProfileSample::MAX_DEPTH));
+        std::copy_n(frames + first, sample.depth, sample.stack);
+    } else {
+        // unwinding through the signal frame failed: interrupted instruction only
+        sample.stack[0] = pc;
+        sample.depth    = pc ? 1 : 0;
+    }
+
+    // labels of the interrupted thread
+    const auto depth = label_stack.depth;
+    std::atomic_signal_fence(std::memory_order_acquire);
+    sample.label_count = static_cast<std::uint32_t>(std::min<std::size_t>(depth, ProfileSample::MAX_LABELS));
+    std::copy_n(label_stack.labels, sample.label_count, sample.labels);
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+std::size_t Profiler::read(std::vector<ProfileSample> &samples) {
+    std::size_t count = 0;
+    while (true) {
+        auto &slot = slots[tail & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+
+        samples.push_back(slot.sample);
+        slot.sequence.store(tail + mask + 1, std::memory_order_release);
+        ++tail;
+        ++count;
+    }
+    return count;
+}
+
+label_id Profiler::intern_label(std::string_view key, std::string_view value) {
+    auto &table = label_table();
+
+    std::string name;
+    name.reserve(key.size() + value.size() + 1);
+    name.append(key).push_back('\0');
+    name.append(value);
+
+    std::lock_guard lock(table.mutex);
+
+    auto it = table.index.find(name);
+    if (it != table.index.end()) return it->second;
+
+    const auto id = static_cast<label_id>(table.labels.size());
+    table.labels.emplace_back(key, value);
+    table.index.emplace(std::move(name), id);
+    return id;
+}
+
+std::pair<std::string, std::string> Profiler::get_label(label_id id) {
+    auto &table = label_table();
+
+    std::lock_guard lock(table.mutex);
+    return table.labels.at(id);
+}
+
+ScopedLabel::ScopedLabel(std::string_view key, std::string_view value) {
+    push_label(Profiler::intern_label(key, value));
+}
+
+ScopedLabel::ScopedLabel(label_id id) noexcept {
+    push_label(id);
+}
+
+ScopedLabel::~ScopedLabel() {
+    --label_stack.depth;
+}
+
+void LabelProfile::add(const ProfileSample &sample) {
+    cpu_time[std::vector<label_id>(sample.labels, sample.labels + sample.label_count)] += sample.period;
+}
+
+void LabelProfile::add(const std::vector<ProfileSample> &samples) {
+    for (const auto &sample : samples)
+        add(sample);
+}
+
+std::map<std::string, double> LabelProfile::get_cpu_by(std::string_view key) const {
+    std::map<std::string, double> result;
+
+    for (const auto &[labels, nsec] : cpu_time) {
+        std::string value;
+        for (auto it = labels.rbegin(); it != labels.rend(); ++it) {
+            auto label = Profiler::get_label(*it);
+            if (label.first == key) {
+                value = std::move(label.second);
+                break;
+            }
+        }
+
+        result[value] += static_cast<double>(nsec) / NSEC_PER_SEC;
+    }
+
+    return result;
+}
+
+double LabelProfile::get_total_cpu() const noexcept {
+    std::int64_t nsec = 0;
+    for (const auto &entry : cpu_time)
+        nsec += entry.second;
+    return static_cast<double>(nsec) / NSEC_PER_SEC;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_profiler_governor.hpp"
+
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <stdexcept>
+
+namespace cxxitimer {
+
+ProfilerGovernor::ProfilerGovernor(ITimer_Prof &_timer, Profiler &_profiler, const Parameters &_parameters)
+    : timer(_timer),
+      profiler(_profiler),
+      parameters(_parameters),
+      last_cpu_time(process_cpu_nsec()),
+      last_handler_time(profiler.get_handler_time()),
+      last_invocations(profiler.get_invocations()) {
+    if (!(parameters.budget > 0.0 && parameters.budget < 1.0)) throw std::invalid_argument("invalid budget");
+    if (!(parameters.target > 0.0 && parameters.target <= 1.0)) throw std::invalid_argument("invalid target");
+    if (!(parameters.min_interval > 0.0) || parameters.max_interval < parameters.min_interval)
+        throw std::invalid_argument("invalid interval bounds");
+    if (parameters.signal_cost < 0.0) throw std::invalid_argument("negative signal cost");
+    if (!(parameters.max_increase > 1.0)) throw std::invalid_argument("invalid maximum increase");
+    if (!(timeval_to_double(timer.get_interval()) > 0.0))
+        throw std::invalid_argument("timer interval must be positive");
+}
+
+double ProfilerGovernor::update() {
+    const auto cpu_time     = process_cpu_nsec();
+    const auto handler_time = profiler.get_handler_time();
+    const auto invocations  = profiler.get_invocations();
+
+    const auto cpu_delta     = static_cast<double>(cpu_time - last_cpu_time) / NSEC_PER_SEC;
+    const auto handler_delta = static_cast<double>(handler_time - last_handler_time) / NSEC_PER_SEC;
+    const auto samples       = static_cast<double>(invocations - last_invocations);
+
+    // not enough data
+    if (!(cpu_delta > 0.0) || samples < 1.0) return overhead;
+
+    last_cpu_time     = cpu_time;
+    last_handler_time = handler_time;
+    last_invocations  = invocations;
+
+    const double sample_cost = handler_delta / samples + parameters.signal_cost;
+    overhead                 = sample_cost * samples / cpu_delta;
+
+    // overhead = sample_cost / interval
+    const double current = get_interval();
+    double       target  = sample_cost / (parameters.budget * parameters.target);
+    if (target < current) target = std::max(target, current / parameters.max_increase);
+    target = std::clamp(target, parameters.min_interval, parameters.max_interval);
+
+    const auto   interval = timer.get_interval();
+    const double factor   = timeval_to_double(interval) / target;
+    if (std::islessgreater(factor, timer.get_speed_factor())) {
+        // restart with a full period: the remaining value of ITIMER_PROF is rounded up to the scheduler tick and would
+        // be scaled by set_speed_factor() of a running timer
+        const bool running = timer.is_running();
+        if (running) timer.stop();
+        timer.set_speed_factor(factor);
+        timer.set_interval_value(interval, interval);
+        if (running) timer.start();
+
+        profiler.update_period(timer);
+    }
+
+    return overhead;
+}
+
+double ProfilerGovernor::get_interval() const noexcept {
+    return timeval_to_double(timer.get_interval()) / timer.get_speed_factor();
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_queue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace cxxitimer {
+
+OrderedTimerQueue::~OrderedTimerQueue() = default;
+
+TimerQueue::timer_id OrderedTimerQueue::schedule(time_point deadline, callback_t callback) {
+    const auto id = ++last_id;
+    index.emplace(id, timers.emplace(deadline, Entry {id, std::move(callback)}));
+    return id;
+}
+
+bool OrderedTimerQueue::cancel(timer_id id) {
+    auto it = index.find(id);
+    if (it == index.end()) return false;
+
+    timers.erase(it->second);
+    index.erase(it);
+    return true;
+}
+
+bool OrderedTimerQueue::reschedule(timer_id id, time_point deadline) {
+    auto it = index.find(id);
+    if (it == index.end()) return false;
+
+    auto node  = timers.extract(it->second);
+    node.key() = deadline;
+    it->second = timers.insert(std::move(node));
+    return true;
+}
+
+std::optional<TimerQueue::time_point> OrderedTimerQueue::next_deadline() {
+    if (timers.empty()) return std::nullopt;
+    return timers.begin()->first;
+}
+
+std::size_t OrderedTimerQueue::pop_expired(time_point now, std::vector<callback_t> &expired) {
+    std::size_t count = 0;
+    while (!timers.empty() && timers.begin()->first <= now) {
+        auto it = timers.begin();
+        index.erase(it->second.id);
+        expired.emplace_back(std::move(it->second.callback));
+        timers.erase(it);
+        ++count;
+    }
+    return count;
+}
+
+std::size_t OrderedTimerQueue::size() const noexcept {
+    return timers.size();
+}
+
+HeapTimerQueue::~HeapTimerQueue() = default;
+
+TimerQueue::timer_id HeapTimerQueue::schedule(time_point deadline, callback_t callback) {
+    const auto id = ++last_id;
+
+    std::size_t node = 0;
+    if (free_nodes.empty()) {
+        node = nodes.size();
+        nodes.push_back(Node {deadline, id, std::move(callback), 0, false});
+    } else {
+        node = free_nodes.back();
+        free_nodes.pop_back();
+        nodes[node] = Node {deadline, id, std::move(callback), 0, false};
+    }
+
+    index.emplace(id, node);
+    heap.push_back(node);
+    nodes[node].heap_pos = heap.size() - 1;
+    sift_up(heap.size() - 1);
+    return id;
+}
+
+bool HeapTimerQueue::cancel(timer_id id) {
+    auto it = index.find(id);
+    if (it == index.end()) return false;
+
+    // lazy removal
+    auto &node     = nodes[it->second];
+    node.tombstone = true;
+    node.callback  = nullptr;
+    index.erase(it);
+    ++tombstones;
+
+    if (tombstones > index.size() && tombstones > ARITY * ARITY) compact();
+    return true;
+}
+
+bool HeapTimerQueue::reschedule(timer_id id, time_point deadline) {
+    auto it = index.find(id);
+    if (it == index.end()) return false;
+
+    auto      &node     = nodes[it->second];
+    const auto previous = node.deadline;
+    node.deadline       = deadline;
+
+    if (deadline < previous) sift_up(node.heap_pos);
+    else
+        sift_down(node.heap_pos);
+    return true;
+}
+
+std::optional<TimerQueue::time_point> HeapTimerQueue::next_deadline() {
+    purge_top();
+    if (heap.empty()) return std::nullopt;
+    return nodes[heap.front()].deadline;
+}
+
+std::size_t HeapTimerQueue::pop_expired(time_point now, std::vector<callback_t> &expired) {
+    std::size_t count = 0;
+    purge_top();
+    while (!heap.empty() && nodes[heap.front()].deadline <= now) {
+        auto &node = nodes[heap.front()];
+        index.erase(node.id);
+        expired.emplace_back(std::move(node.callback));
+        pop_top();
+        purge_top();
+        ++count;
+    }
+    return count;
+}
+
+std::size_t HeapTimerQueue::size() const noexcept {
+    return index.size();
+}
+
+void HeapTimerQueue::sift_up(std::size_t pos) noexcept {
+    const auto node     = heap[pos];
+    const auto deadline = nodes[node].deadline;
+
+    while (pos > 0) {
+        const auto parent = (pos - 1) / ARITY;
+        if (!(deadline < nodes[heap[parent]].deadline)) break;
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+    place(pos, node);
+}
+
+void HeapTimerQueue::sift_down(std::size_t pos) noexcept {
+    const auto node     = heap[pos];
+    const auto deadline = nodes[node].deadline;
+    const auto count    = heap.size();
+
+    while (true) {
+        const auto first_child = pos * ARITY + 1;
+        if (first_child >= count) break;
+
+        // find earliest child
+        auto       min_child = first_child;
+        const auto end       = std::min(first_child + ARITY, count);
+        for (auto child = first_child + 1; child < end; ++child)
+            if (nodes[heap[child]].deadline < nodes[heap[min_child]].deadline) min_child = child;
+
+        if (!(nodes[heap[min_child]].deadline < deadline)) break;
+        place(pos, heap[min_child]);
+        pos = min_child;
+    }
+    place(pos, node);
+}
+
+void HeapTimerQueue::pop_top() noexcept {
+    free_nodes.push_back(heap.front());
+
+    const auto last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        place(0, last);
+        sift_down(0);
+    }
+}
+
+void HeapTimerQueue::purge_top() noexcept {
+    while (!heap.empty() && nodes[heap.front()].tombstone) {
+        pop_top();
+        --tombstones;
+    }
+}
+
+void HeapTimerQueue::compact() {
+    std::vector<std::size_t> live;
+    live.reserve(index.size());
+    for (const auto node : heap) {
+        if (nodes[node].tombstone) free_nodes.push_back(node);
+        else
+            live.push_back(node);
+    }
+
+    heap = std::move(live);
+    for (std::size_t pos = 0; pos < heap.size(); ++pos)
+        nodes[heap[pos]].heap_pos = pos;
+
+    // heapify (bottom up)
+    for (auto pos = heap.size() / ARITY + 1; pos-- > 0;)
+        if (pos < heap.size()) sift_down(pos);
+
+    tombstones = 0;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_queue_dispatcher.hpp"
+
+#include "time_util.hpp"
+
+#include <ctime>
+#include <stdexcept>
+#include <sys/resource.h>
+#include <utility>
+
+namespace cxxitimer {
+
+//* minimum delay the kernel timer is armed with
+static constexpr std::chrono::microseconds MIN_DELAY(10);
+
+QueueDispatcher::QueueDispatcher(ITimer &_timer, TimerQueue &_queue)
+    : timer(_timer), queue(_queue), sequence(broadcast.get_sequence()) {
+    if (timer.is_running()) throw std::logic_error("timer is running");
+
+    broadcast.attach(timer);
+
+    std::lock_guard lock(mutex);
+    rearm();
+}
+
+QueueDispatcher::~QueueDispatcher() {
+    std::lock_guard lock(mutex);
+
+    std::error_code ec;
+    if (timer.is_running()) timer.stop(ec);
+}
+
+QueueDispatcher::time_point QueueDispatcher::now() const noexcept {
+    return now(timer.get_type());
+}
+
+QueueDispatcher::time_point QueueDispatcher::now(int type) noexcept {
+    if (type == ITIMER_VIRTUAL) {
+        // user CPU time
+        rusage usage {};
+        getrusage(RUSAGE_SELF, &usage);
+        return std::chrono::seconds(usage.ru_utime.tv_sec) + std::chrono::microseconds(usage.ru_utime.tv_usec);
+    }
+
+    return std::chrono::nanoseconds(clock_nsec(type == ITIMER_PROF ? CLOCK_PROCESS_CPUTIME_ID : CLOCK_MONOTONIC));
+}
+
+QueueDispatcher::timer_id QueueDispatcher::schedule_at(time_point deadline, callback_t callback) {
+    std::lock_guard lock(mutex);
+    const auto      id = queue.schedule(deadline, std::move(callback));
+    rearm();
+    return id;
+}
+
+QueueDispatcher::timer_id QueueDispatcher::schedule_after(std::chrono::nanoseconds delay, callback_t callback) {
+    return schedule_at(now() + delay, std::move(callback));
+}
+
+bool QueueDispatcher::cancel(timer_id id) {
+    std::lock_guard lock(mutex);
+    const bool      canceled = queue.cancel(id);
+    if (canceled) rearm();
+    return canceled;
+}
+
+bool QueueDispatcher::reschedule(timer_id id, time_point deadline) {
+    std::lock_guard lock(mutex);
+    const bool      rescheduled = queue.reschedule(id, deadline);
+    if (rescheduled) rearm();
+    return rescheduled;
+}
+
+std::size_t QueueDispatcher::dispatch() {
+    std::vector<callback_t> expired;
+
+    {
+        std::lock_guard lock(mutex);
+        queue.pop_expired(now(), expired);
+        rearm();
+    }
+
+    // execute callbacks without holding the lock (callbacks may schedule timers)
+    for (auto &callback : expired)
+        callback();
+
+    return expired.size();
+}
+
+std::size_t QueueDispatcher::wait_and_dispatch() {
+    sequence = broadcast.wait_for_tick(sequence);
+    return dispatch();
+}
+
+std::size_t QueueDispatcher::wait_and_dispatch(const timeval &timeout) {
+    sequence = broadcast.wait_for_tick(sequence, timeout);
+    return dispatch();
+}
+
+std::size_t QueueDispatcher::size() const {
+    std::lock_guard lock(mutex);
+    return queue.size();
+}
+
+void QueueDispatcher::rearm() {
+    const auto deadline = queue.next_deadline();
+    if (deadline == armed_deadline && timer.is_running() == deadline.has_value()) return;
+
+    if (timer.is_running()) timer.stop();
+    armed_deadline = deadline;
+
+    if (!deadline) return;
+
+    auto delay = *deadline - now();
+    if (delay < MIN_DELAY) delay = MIN_DELAY;
+
+    // the timer divides the value by its speed factor
+    const auto value = std::chrono::duration<double>(delay).count() * timer.get_speed_factor();
+    timer.set_interval_value(value, value);
+    timer.start();
+}
+
+}  // namespace cxxitimer
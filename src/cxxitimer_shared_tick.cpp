@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_shared_tick.hpp"
+
+#include "shared_memory.hpp"
+#include "time_util.hpp"
+
+#include <bit>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <new>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace cxxitimer {
+
+//* identifies a page of a SharedTickSource
+static constexpr std::uint64_t SHARED_TICK_MAGIC = 0x6378786974696b31;  // "cxxitik1"
+
+//* layout of the shared memory page
+struct SharedTickPage {
+    //* SHARED_TICK_MAGIC if initialized
+    std::atomic<std::uint64_t> magic;
+
+    //* seqlock (odd: write in progress)
+    alignas(64) std::atomic<std::uint32_t> seqlock;
+
+    //* tick count of the snapshot
+    std::atomic<std::uint64_t> snapshot_ticks;
+
+    //* CLOCK_REALTIME at the last tick (nsec)
+    std::atomic<std::int64_t> realtime_nsec;
+
+    //* CLOCK_MONOTONIC at the last tick (nsec)
+    std::atomic<std::int64_t> monotonic_nsec;
+
+    //* speed factor (bit representation of the double value)
+    std::atomic<std::uint64_t> speed_factor;
+
+    //* number of ticks
+    alignas(64) std::atomic<std::uint64_t> ticks;
+
+    //* lower 32 bits of the number of ticks (futex word)
+    std::atomic<std::uint32_t> futex_word;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "lock free 64 bit atomics required");
+
+SharedTickSource::SharedTickSource(ITimer &_timer, const std::string &name, mode_t mode)
+    : timer(_timer),
+      shm(std::make_unique<SharedMemory>(name, sizeof(SharedTickPage), true, mode)),
+      page(new (shm->get_addr()) SharedTickPage {}) {
+    page->speed_factor.store(std::bit_cast<std::uint64_t>(timer.get_speed_factor()), std::memory_order_relaxed);
+    page->realtime_nsec.store(clock_nsec(CLOCK_REALTIME), std::memory_order_relaxed);
+    page->monotonic_nsec.store(clock_nsec(CLOCK_MONOTONIC), std::memory_order_relaxed);
+    page->magic.store(SHARED_TICK_MAGIC, std::memory_order_release);
+
+    attach(timer);
+}
+
+SharedTickSource::~SharedTickSource() {
+    detach();
+}
+
+void SharedTickSource::set_speed_factor(double factor) {
+    timer.set_speed_factor(factor);
+}
+
+void SharedTickSource::on_tick(void *) noexcept {
+    const auto ticks = page->ticks.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    // update snapshot (skipped if the handler executes concurrently in another thread)
+    std::uint32_t seq = 0;
+    if (seqlock_try_write_begin(page->seqlock, seq)) {
+        page->snapshot_ticks.store(ticks, std::memory_order_relaxed);
+        page->realtime_nsec.store(clock_nsec(CLOCK_REALTIME), std::memory_order_relaxed);
+        page->monotonic_nsec.store(clock_nsec(CLOCK_MONOTONIC), std::memory_order_relaxed);
+        page->speed_factor.store(std::bit_cast<std::uint64_t>(timer.get_speed_factor()), std::memory_order_relaxed);
+        seqlock_write_end(page->seqlock, seq);
+    }
+
+    // wake all waiting processes
+    page->futex_word.store(static_cast<std::uint32_t>(ticks), std::memory_order_release);
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&page->futex_word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+SharedTickReader::SharedTickReader(const std::string &name)
+    : shm(std::make_unique<SharedMemory>(SharedMemory::open(name, sizeof(SharedTickPage), false))),
+      page(static_cast<const SharedTickPage *>(shm->get_addr())) {
+    if (page->magic.load(std::memory_order_acquire) != SHARED_TICK_MAGIC)
+        throw std::runtime_error("not a shared tick page");
+}
+
+SharedTickReader::~SharedTickReader() = default;
+
+SharedTickSnapshot SharedTickReader::read() const noexcept {
+    SharedTickSnapshot snapshot {};
+    seqlock_read(page->seqlock, [&] {
+        snapshot.ticks          = page->snapshot_ticks.load(std::memory_order_relaxed);
+        snapshot.realtime_nsec  = page->realtime_nsec.load(std::memory_order_relaxed);
+        snapshot.monotonic_nsec = page->monotonic_nsec.load(std::memory_order_relaxed);
+        snapshot.speed_factor   = std::bit_cast<double>(page->speed_factor.load(std::memory_order_relaxed));
+    });
+    return snapshot;
+}
+
+std::uint64_t SharedTickReader::get_ticks() const noexcept {
+    return page->ticks.load(std::memory_order_acquire);
+}
+
+std::uint64_t SharedTickReader::wait_for_tick(std::uint64_t ticks) const noexcept {
+    std::uint64_t current = 0;
+    while ((current = page->ticks.load(std::memory_order_acquire)) == ticks) {
+        // futex_wait only reads the futex word --> works on read only mappings
+        syscall(SYS_futex,
+                const_cast<std::uint32_t *>(reinterpret_cast<const std::uint32_t *>(&page->futex_word)),
+                FUTEX_WAIT,
+                static_cast<std::uint32_t>(ticks),
+                nullptr,
+                nullptr,
+                0);
+    }
+    return current;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_speed_coordinator.hpp"
+
+#include "shared_memory.hpp"
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <ctime>
+#include <linux/futex.h>
+#include <new>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace cxxitimer {
+
+//* identifies a page of a SpeedCoordinator
+static constexpr std::uint64_t SPEED_COORDINATION_MAGIC = 0x6378786973706431;  // "cxxispd1"
+
+//* number of changes that are kept in the shared memory page
+static constexpr std::size_t SPEED_HISTORY = 16;
+
+//* speed factor change in the shared memory page
+struct SpeedCoordinationEntry {
+    //* sequence number of the change
+    std::atomic<std::uint64_t> generation;
+
+    //* speed factor (bit representation of the double value)
+    std::atomic<std::uint64_t> speed_factor;
+
+    //* CLOCK_MONOTONIC time at which the change is applied (nsec)
+    std::atomic<std::int64_t> apply_at_nsec;
+};
+
+//* layout of the shared memory page
+struct SpeedCoordinationPage {
+    //* SPEED_COORDINATION_MAGIC if initialized
+    std::atomic<std::uint64_t> magic;
+
+    //* seqlock (odd: write in progress)
+    alignas(64) std::atomic<std::uint32_t> seqlock;
+
+    //* number of entries written to the history (the last entry is the last announced change)
+    std::atomic<std::uint64_t> entries;
+
+    //* last announced changes (ring buffer, ordered by the time at which they are applied)
+    std::array<SpeedCoordinationEntry, SPEED_HISTORY> history;
+
+    //* lower 32 bits of the generation (futex word)
+    alignas(64) std::atomic<std::uint32_t> futex_word;
+};
+
+namespace {
+
+//* copy of the history of a page
+struct SpeedHistory {
+    //* changes (oldest first)
+    std::array<SpeedChange, SPEED_HISTORY> changes;
+
+    //* number of changes
+    std::size_t size;
+};
+
+SpeedHistory read_history(const SpeedCoordinationPage *page) noexcept {
+    SpeedHistory history {};
+    seqlock_read(page->seqlock, [&] {
+        const auto entries = page->entries.load(std::memory_order_relaxed);
+        history.size       = static_cast<std::size_t>(std::min<std::uint64_t>(entries, SPEED_HISTORY));
+
+        for (std::size_t i = 0; i < history.size; ++i) {
+            const auto &entry  = page->history[(entries - history.size + i) % SPEED_HISTORY];
+            auto       &change = history.changes[i];
+
+            change.generation    = entry.generation.load(std::memory_order_relaxed);
+            change.speed_factor  = std::bit_cast<double>(entry.speed_factor.load(std::memory_order_relaxed));
+            change.apply_at_nsec = entry.apply_at_nsec.load(std::memory_order_relaxed);
+        }
+    });
+    return history;
+}
+
+SpeedChange read_change(const SpeedCoordinationPage *page) noexcept {
+    const auto history = read_history(page);
+    return history.size > 0 ? history.changes[history.size - 1] : SpeedChange {0, 1.0, 0};
+}
+
+/**
+ * @brief apply the due changes that were not applied yet
+ * @details
+ * The changes are applied in order, each as of its instant (see ITimer::set_speed_factor_since).
+ * Therefore, the timer stays in phase even if changes are applied late or several changes are applied at once.
+ * @param timer timer
+ * @param applied_generation sequence number of the last applied change (updated)
+ * @param history changes
+ * @param now current time (CLOCK_MONOTONIC, nsec)
+ * @return last applied change (generation 0: no change applied)
+ * @exception std::system_error call of setitimer failed
+ */
+SpeedChange apply_due(ITimer &timer, std::uint64_t &applied_generation, const SpeedHistory &history, std::int64_t now) {
+    SpeedChange applied {0, 0.0, 0};
+    for (std::size_t i = 0; i < history.size; ++i) {
+        const auto &change = history.changes[i];
+        if (change.generation <= applied_generation || change.apply_at_nsec > now) continue;
+
+        timer.set_speed_factor_since(change.speed_factor, change.apply_at_nsec);
+        applied_generation = change.generation;
+        applied            = change;
+    }
+    return applied;
+}
+
+}  // namespace
+
+SpeedCoordinator::SpeedCoordinator(const std::string &name, mode_t mode)
+    : shm(std::make_unique<SharedMemory>(name, sizeof(SpeedCoordinationPage), true, mode)),
+      page(new (shm->get_addr()) SpeedCoordinationPage {}) {
+    page->magic.store(SPEED_COORDINATION_MAGIC, std::memory_order_release);
+}
+
+SpeedCoordinator::~SpeedCoordinator() = default;
+
+std::uint64_t SpeedCoordinator::schedule(double factor, const timeval &delay) {
+    // check speed_factor
+    if (factor <= 0.0) throw std::invalid_argument("negative values not allowed");
+
+    if (std::isnan(factor) || std::isinf(factor)) throw std::invalid_argument("invalid double value");
+
+    const auto now      = monotonic_nsec();
+    const auto apply_at = now + std::int64_t {delay.tv_sec} * NSEC_PER_SEC + delay.tv_usec * NSEC_PER_USEC;
+
+    // the write section serializes writers of all threads and processes that map the page
+    const auto  seq     = seqlock_write_begin(page->seqlock);
+    const auto  entries = page->entries.load(std::memory_order_relaxed);
+    const auto &last    = page->history[(entries + SPEED_HISTORY - 1) % SPEED_HISTORY];
+
+    // a pending change that was not applied yet is replaced
+    const bool replace    = entries > 0 && last.apply_at_nsec.load(std::memory_order_relaxed) > now;
+    const auto generation = entries > 0 ? last.generation.load(std::memory_order_relaxed) + 1 : 1;
+    const auto index      = replace ? entries - 1 : entries;
+
+    auto &entry = page->history[index % SPEED_HISTORY];
+    entry.generation.store(generation, std::memory_order_relaxed);
+    entry.speed_factor.store(std::bit_cast<std::uint64_t>(factor), std::memory_order_relaxed);
+    entry.apply_at_nsec.store(apply_at, std::memory_order_relaxed);
+    page->entries.store(index + 1, std::memory_order_relaxed);
+    page->futex_word.store(static_cast<std::uint32_t>(generation), std::memory_order_release);
+    seqlock_write_end(page->seqlock, seq);
+
+    // wake all waiting followers
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&page->futex_word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+
+    return generation;
+}
+
+SpeedChange SpeedCoordinator::get_change() const noexcept {
+    return read_change(page);
+}
+
+SpeedFollower::SpeedFollower(ITimer &_timer, const std::string &name)
+    : timer(_timer),
+      shm(std::make_unique<SharedMemory>(SharedMemory::open(name, sizeof(SpeedCoordinationPage), false))),
+      page(static_cast<const SpeedCoordinationPage *>(shm->get_addr())) {
+    if (page->magic.load(std::memory_order_acquire) != SPEED_COORDINATION_MAGIC)
+        throw std::runtime_error("not a speed coordination page");
+
+    applied_generation = read_change(page).generation;
+}
+
+SpeedFollower::~SpeedFollower() = default;
+
+bool SpeedFollower::poll() {
+    return apply_due(timer, applied_generation, read_history(page), monotonic_nsec()).generation != 0;
+}
+
+SpeedChange SpeedFollower::wait_and_apply() {
+    while (true) {
+        const auto history = read_history(page);
+
+        // first change that was not applied yet
+        std::size_t next = 0;
+        while (next < history.size && history.changes[next].generation <= applied_generation)
+            ++next;
+
+        if (next == history.size) {
+            // wait for announcement
+            syscall(SYS_futex,
+                    const_cast<std::uint32_t *>(reinterpret_cast<const std::uint32_t *>(&page->futex_word)),
+                    FUTEX_WAIT,
+                    static_cast<std::uint32_t>(applied_generation),
+                    nullptr,
+                    nullptr,
+                    0);
+            continue;
+        }
+
+        // sleep until the common instant
+        const timespec apply_at = nsec_to_timespec(history.changes[next].apply_at_nsec);
+        int            tmp      = 0;
+        do {
+            tmp = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &apply_at, nullptr);
+        } while (tmp == EINTR);
+        if (tmp) throw std::system_error(tmp, std::generic_category(), "call of clock_nanosleep failed");
+
+        // the change might have been replaced in the meantime
+        const auto applied = apply_due(timer, applied_generation, read_history(page), monotonic_nsec());
+        if (applied.generation != 0) return applied;
+    }
+}
+
+SpeedChange SpeedFollower::get_change() const noexcept {
+    return read_change(page);
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_tick.hpp"
+
+#include "time_util.hpp"
+
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <ctime>
+#include <linux/futex.h>
+#include <mutex>
+#include <sched.h>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace cxxitimer {
+
+//* maximum number of hooks per signal
+static constexpr std::size_t MAX_HOOKS = 16;
+
+namespace {
+
+//* hooks that are attached to one timer signal
+struct SignalSlot {
+    //* signal number
+    const int signal;
+
+    //* attached hooks
+    std::array<std::atomic<TickHook *>, MAX_HOOKS> hooks {};
+
+    //* number of signal handlers that currently execute the hooks
+    std::atomic<unsigned> active {0};
+
+    //* number of attached hooks (protected by slot_mutex)
+    std::size_t attached = 0;
+
+    //* signal handler that was installed before the first hook was attached
+    struct sigaction previous {};
+
+    explicit SignalSlot(int signal) noexcept : signal(signal) {}
+};
+
+std::array<SignalSlot, 3> slots {SignalSlot(SIGALRM), SignalSlot(SIGVTALRM), SignalSlot(SIGPROF)};
+
+//* protects attaching/detaching of hooks
+std::mutex slot_mutex;
+
+SignalSlot *get_slot(int signal) noexcept {
+    for (auto &slot : slots)
+        if (slot.signal == signal) return &slot;
+    return nullptr;
+}
+
+void tick_handler(int signal, siginfo_t *info, void *context) {
+    const int saved_errno = errno;
+
+    auto *slot = get_slot(signal);
+    if (slot) {
+        slot->active.fetch_add(1, std::memory_order_seq_cst);
+        for (auto &entry : slot->hooks) {
+            auto *hook = entry.load(std::memory_order_acquire);
+            if (hook) hook->on_tick(context);
+        }
+        slot->active.fetch_sub(1, std::memory_order_release);
+
+        // chain previously installed signal handler
+        const auto &previous = slot->previous;
+        if (previous.sa_flags & SA_SIGINFO) {
+            if (previous.sa_sigaction) previous.sa_sigaction(signal, info, context);
+        } else if (previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+            previous.sa_handler(signal);
+        }
+    }
+
+    errno = saved_errno;
+}
+
+long futex(std::atomic<std::uint32_t> *addr, int op, std::uint32_t val, const timespec *timeout) noexcept {
+    return syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(addr), op, val, timeout, nullptr, 0);
+}
+
+}  // namespace
+
+TickHook::~TickHook() {
+    detach();
+}
+
+void TickHook::attach(int sig) {
+    auto *slot = get_slot(sig);
+    if (!slot) throw std::invalid_argument("not a timer signal");
+
+    std::lock_guard lock(slot_mutex);
+
+    if (signal != 0) throw std::logic_error("hook already attached");
+
+    std::atomic<TickHook *> *free_entry = nullptr;
+    for (auto &entry : slot->hooks) {
+        if (!entry.load(std::memory_order_relaxed)) {
+            free_entry = &entry;
+            break;
+        }
+    }
+    if (!free_entry) throw std::runtime_error("too many hooks attached to signal");
+
+    if (slot->attached == 0) {
+        // install library signal handler
+        struct sigaction sa {};
+        sa.sa_sigaction = tick_handler;
+        sa.sa_flags     = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+
+        struct sigaction previous {};
+        int tmp = sigaction(sig, nullptr, &previous);
+        if (tmp) throw std::system_error(errno, std::generic_category(), "call of sigaction failed");
+        slot->previous = previous;
+
+        tmp = sigaction(sig, &sa, nullptr);
+        if (tmp) throw std::system_error(errno, std::generic_category(), "call of sigaction failed");
+    }
+
+    free_entry->store(this, std::memory_order_release);
+    ++slot->attached;
+    signal = sig;
+}
+
+void TickHook::detach() noexcept {
+    std::lock_guard lock(slot_mutex);
+
+    if (signal == 0) return;
+
+    auto *slot = get_slot(signal);
+    for (auto &entry : slot->hooks) {
+        if (entry.load(std::memory_order_relaxed) == this) {
+            entry.store(nullptr, std::memory_order_seq_cst);
+            break;
+        }
+    }
+
+    if (--slot->attached == 0) {
+        // restore previous signal handler
+        sigaction(signal, &slot->previous, nullptr);
+    }
+
+    // wait for signal handlers that might still use this hook
+    while (slot->active.load(std::memory_order_seq_cst) != 0)
+        sched_yield();
+
+    signal = 0;
+}
+
+TickBroadcast::TickBroadcast(const ITimer &timer) {
+    attach(timer);
+}
+
+TickBroadcast::~TickBroadcast() {
+    detach();
+}
+
+void TickBroadcast::publish() noexcept {
+    sequence.fetch_add(1, std::memory_order_seq_cst);
+
+    // wake all blocked threads with a single system call
+    if (waiters.load(std::memory_order_seq_cst) != 0) futex(&sequence, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+}
+
+std::uint32_t TickBroadcast::wait_for_tick(std::uint32_t seq) noexcept {
+    std::uint32_t current = sequence.load(std::memory_order_acquire);
+    if (current != seq) return current;
+
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    while ((current = sequence.load(std::memory_order_seq_cst)) == seq)
+        futex(&sequence, FUTEX_WAIT_PRIVATE, seq, nullptr);
+    waiters.fetch_sub(1, std::memory_order_release);
+
+    return current;
+}
+
+std::uint32_t TickBroadcast::wait_for_tick(std::uint32_t seq, const timeval &timeout) noexcept {
+    std::uint32_t current = sequence.load(std::memory_order_acquire);
+    if (current != seq) return current;
+
+    // absolute deadline (CLOCK_MONOTONIC, nsec)
+    const auto deadline =
+            monotonic_nsec() + std::int64_t {timeout.tv_sec} * NSEC_PER_SEC + timeout.tv_usec * NSEC_PER_USEC;
+
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    while ((current = sequence.load(std::memory_order_seq_cst)) == seq) {
+        const auto remaining = deadline - monotonic_nsec();
+        if (remaining < 0) break;
+
+        const timespec timeout_spec = nsec_to_timespec(remaining);
+        futex(&sequence, FUTEX_WAIT_PRIVATE, seq, &timeout_spec);
+    }
+    waiters.fetch_sub(1, std::memory_order_release);
+
+    return current;
+}
+
+std::uint32_t TickBroadcast::spin_for_tick(std::uint32_t seq) const noexcept {
+    std::uint32_t current = 0;
+    while ((current = sequence.load(std::memory_order_acquire)) == seq) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    return current;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_tsc.hpp"
+
+#include "time_util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <ctime>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <cpuid.h>
+#    include <x86intrin.h>
+#    define CXXITIMER_HAS_TSC 1
+#else
+#    define CXXITIMER_HAS_TSC 0
+#endif
+
+namespace cxxitimer {
+
+//* minimum duration between two calibration points (nsec)
+static constexpr std::int64_t MIN_CALIBRATION_NSEC = 1000000;
+
+//* number of reads per calibration sample
+static constexpr std::size_t SAMPLE_ATTEMPTS = 4;
+
+namespace {
+
+//* conversion from TSC to CLOCK_MONOTONIC
+struct Calibration {
+    //* TSC at the calibration point
+    std::atomic<std::uint64_t> base_tsc {0};
+
+    //* time of the clock at the calibration point (nsec)
+    std::atomic<std::int64_t> base_nsec {0};
+
+    //* CLOCK_MONOTONIC at the calibration point (nsec)
+    std::atomic<std::int64_t> sample_nsec {0};
+
+    //* measured nsec per TSC tick (0: not calibrated)
+    std::atomic<double> nsec_per_tick {0.0};
+
+    //* additional nsec per TSC tick to correct the offset to CLOCK_MONOTONIC
+    std::atomic<double> slew_nsec_per_tick {0.0};
+
+    //* number of TSC ticks after the calibration point for which the slew is applied
+    std::atomic<std::uint64_t> slew_ticks {0};
+};
+
+/**
+ * @brief calibration data (double buffered)
+ * @details
+ * The writer only modifies the inactive buffer and switches the buffers by incrementing the generation.
+ * Therefore, the reader never has to wait for the writer (async-signal-safe).
+ */
+struct CalibrationState {
+    std::array<Calibration, 2> buffers;
+    std::atomic<std::uint64_t> generation {0};
+};
+
+CalibrationState state;
+
+bool detect_invariant_tsc() noexcept {
+#if CXXITIMER_HAS_TSC
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+
+    // advanced power management information
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+    return edx & (1U << 8U);
+#else
+    return false;
+#endif
+}
+
+const bool invariant_tsc = detect_invariant_tsc();
+
+/**
+ * @brief time since a calibration point
+ * @param ticks TSC ticks since the calibration point
+ * @param nsec_per_tick measured nsec per TSC tick
+ * @param slew_nsec_per_tick additional nsec per TSC tick during the slew
+ * @param slew_ticks duration of the slew (TSC ticks)
+ * @return nsec since the calibration point
+ */
+std::int64_t elapsed_nsec(std::uint64_t ticks,
+                          double        nsec_per_tick,
+                          double        slew_nsec_per_tick,
+                          std::uint64_t slew_ticks) noexcept {
+    const auto slewed = static_cast<double>(std::min(ticks, slew_ticks)) * slew_nsec_per_tick;
+    return static_cast<std::int64_t>(static_cast<double>(ticks) * nsec_per_tick + slewed);
+}
+
+/**
+ * @brief read the TSC and CLOCK_MONOTONIC
+ * @details
+ * The TSC is read first. Therefore, CLOCK_MONOTONIC at the returned TSC value is never larger than the returned time
+ * and the clock does not go back when it switches from CLOCK_MONOTONIC to the TSC.
+ *
+ * The TSC is read again after CLOCK_MONOTONIC and the sample with the shortest window is used (the thread might be
+ * interrupted between the reads, which would distort the measured rate).
+ */
+void sample(std::uint64_t &tsc, std::int64_t &nsec) noexcept {
+    auto window = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t i = 0; i < SAMPLE_ATTEMPTS; ++i) {
+        const auto before = TscClock::read_tsc();
+        const auto time   = monotonic_nsec();
+        const auto after  = TscClock::read_tsc();
+
+        if (after - before < window) {
+            window = after - before;
+            tsc    = before;
+            nsec   = time;
+        }
+    }
+}
+
+/**
+ * @brief publish a new calibration point
+ * @details
+ * If the clock is already calibrated, the new calibration continues from the time of the previous one at the new
+ * calibration point (the clock does not step). The offset to CLOCK_MONOTONIC is corrected by a slew of at most
+ * TscClock::MAX_SLEW_PPM that ends after at most TscClock::MAX_SLEW_TIME. The measured rate is stored unchanged.
+ * @param tsc TSC at the calibration point
+ * @param nsec CLOCK_MONOTONIC at the calibration point
+ * @param rate measured nsec per TSC tick (0: not calibrated)
+ */
+void publish(std::uint64_t tsc, std::int64_t nsec, double rate) noexcept {
+    const auto  generation = state.generation.load(std::memory_order_relaxed);
+    const auto &active     = state.buffers[generation & 1U];
+    auto       &inactive   = state.buffers[(generation + 1) & 1U];
+
+    auto          base_nsec          = nsec;
+    auto          slew_nsec_per_tick = 0.0;
+    std::uint64_t slew_ticks         = 0;
+
+    const auto active_nsec_per_tick = active.nsec_per_tick.load(std::memory_order_relaxed);
+    if (active_nsec_per_tick > 0.0 && rate > 0.0) {
+        // + 1: values that were calculated with the previous calibration while this one is published are smaller
+        base_nsec = active.base_nsec.load(std::memory_order_relaxed) +
+                    elapsed_nsec(tsc - active.base_tsc.load(std::memory_order_relaxed),
+                                 active_nsec_per_tick,
+                                 active.slew_nsec_per_tick.load(std::memory_order_relaxed),
+                                 active.slew_ticks.load(std::memory_order_relaxed)) +
+                    1;
+
+        // positive: the clock is behind CLOCK_MONOTONIC
+        const auto offset   = static_cast<double>(nsec - base_nsec);
+        const auto max_slew = rate * TscClock::MAX_SLEW_PPM / 1e6;
+        const auto max_time = static_cast<double>(TscClock::MAX_SLEW_TIME.count()) / rate;
+
+        // ceil: the slew does not exceed max_slew
+        slew_ticks = static_cast<std::uint64_t>(std::ceil(std::min(std::abs(offset) / max_slew, max_time)));
+        if (slew_ticks > 0)
+            slew_nsec_per_tick = std::clamp(offset / static_cast<double>(slew_ticks), -max_slew, max_slew);
+    }
+
+    inactive.base_tsc.store(tsc, std::memory_order_relaxed);
+    inactive.base_nsec.store(base_nsec, std::memory_order_relaxed);
+    inactive.sample_nsec.store(nsec, std::memory_order_relaxed);
+    inactive.nsec_per_tick.store(rate, std::memory_order_relaxed);
+    inactive.slew_nsec_per_tick.store(slew_nsec_per_tick, std::memory_order_relaxed);
+    inactive.slew_ticks.store(slew_ticks, std::memory_order_relaxed);
+    state.generation.store(generation + 1, std::memory_order_release);
+}
+
+//* initial calibration point (library load)
+struct InitialCalibrationPoint {
+    InitialCalibrationPoint() noexcept {
+        if (!invariant_tsc) return;
+
+        std::uint64_t tsc  = 0;
+        std::int64_t  nsec = 0;
+        sample(tsc, nsec);
+        publish(tsc, nsec, 0.0);
+    }
+};
+
+const InitialCalibrationPoint initial_calibration_point;
+
+}  // namespace
+
+TscClock::time_point TscClock::now() noexcept {
+    if (invariant_tsc) {
+        while (true) {
+            const auto  generation         = state.generation.load(std::memory_order_acquire);
+            const auto &calibration        = state.buffers[generation & 1U];
+            const auto  nsec_per_tick      = calibration.nsec_per_tick.load(std::memory_order_relaxed);
+            const auto  slew_nsec_per_tick = calibration.slew_nsec_per_tick.load(std::memory_order_relaxed);
+            const auto  slew_ticks         = calibration.slew_ticks.load(std::memory_order_relaxed);
+            const auto  base_tsc           = calibration.base_tsc.load(std::memory_order_relaxed);
+            const auto  base_nsec          = calibration.base_nsec.load(std::memory_order_relaxed);
+
+            // read inside the generation check: values of an old calibration are calculated before it is replaced
+            const auto tsc = read_tsc();
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (state.generation.load(std::memory_order_relaxed) != generation) continue;
+
+            if (nsec_per_tick <= 0.0) break;
+
+            // the TSC might be read in another thread slightly before the calibration point
+            const auto ticks = tsc > base_tsc ? tsc - base_tsc : 0;
+            return time_point(
+                    duration(base_nsec + elapsed_nsec(ticks, nsec_per_tick, slew_nsec_per_tick, slew_ticks)));
+        }
+    }
+
+    return time_point(duration(monotonic_nsec()));
+}
+
+std::uint64_t TscClock::read_tsc() noexcept {
+#if CXXITIMER_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+bool TscClock::is_invariant() noexcept {
+    return invariant_tsc;
+}
+
+bool TscClock::is_calibrated() noexcept {
+    return get_frequency() > 0.0;
+}
+
+double TscClock::get_frequency() noexcept {
+    if (!invariant_tsc) return 0.0;
+
+    const auto &calibration   = state.buffers[state.generation.load(std::memory_order_acquire) & 1U];
+    const auto  nsec_per_tick = calibration.nsec_per_tick.load(std::memory_order_relaxed);
+    return nsec_per_tick > 0.0 ? static_cast<double>(NSEC_PER_SEC) / nsec_per_tick : 0.0;
+}
+
+void TscClock::calibrate(duration calibration_time) noexcept {
+    if (!invariant_tsc) return;
+
+    std::uint64_t start_tsc  = 0;
+    std::int64_t  start_nsec = 0;
+    sample(start_tsc, start_nsec);
+
+    const auto    end = start_nsec + std::max(calibration_time.count(), rep {MIN_CALIBRATION_NSEC});
+    std::uint64_t tsc = 0;
+    std::int64_t  nsec = 0;
+    do {
+        sample(tsc, nsec);
+    } while (nsec < end);
+
+    publish(tsc, nsec, static_cast<double>(nsec - start_nsec) / static_cast<double>(tsc - start_tsc));
+}
+
+void TscClock::recalibrate() noexcept {
+    if (!invariant_tsc) return;
+
+    const auto &calibration = state.buffers[state.generation.load(std::memory_order_acquire) & 1U];
+    const auto  base_tsc    = calibration.base_tsc.load(std::memory_order_relaxed);
+    const auto  sample_nsec = calibration.sample_nsec.load(std::memory_order_relaxed);
+
+    std::uint64_t tsc  = 0;
+    std::int64_t  nsec = 0;
+    sample(tsc, nsec);
+
+    if (nsec - sample_nsec < MIN_CALIBRATION_NSEC || tsc <= base_tsc) return;
+
+    publish(tsc, nsec, static_cast<double>(nsec - sample_nsec) / static_cast<double>(tsc - base_tsc));
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxitimer_work_slicer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace cxxitimer {
+
+WorkSlicer::WorkSlicer(const ITimer &timer, TscClock::duration _budget)
+    : cursor(jobs.end()), budget(_budget), broadcast(timer), sequence(broadcast.get_sequence()) {}
+
+WorkSlicer::~WorkSlicer() = default;
+
+WorkSlicer::job_id WorkSlicer::add_job(job_t job) {
+    const auto id = ++last_id;
+    jobs.push_back(Job {id, std::move(job)});
+    if (cursor == jobs.end()) cursor = std::prev(jobs.end());
+    return id;
+}
+
+bool WorkSlicer::remove_job(job_id id) noexcept {
+    // only mark as removed (the job might currently be executed)
+    auto it = std::find_if(jobs.begin(), jobs.end(), [id](const Job &job) { return job.id == id && !job.removed; });
+    if (it == jobs.end()) return false;
+
+    it->removed = true;
+    return true;
+}
+
+std::size_t WorkSlicer::run_slice() {
+    const SliceBudget slice(TscClock::now() + budget);
+
+    std::size_t executed  = 0;
+    auto        remaining = jobs.size();
+    while (remaining-- > 0 && !jobs.empty()) {
+        if (cursor == jobs.end()) cursor = jobs.begin();
+
+        auto current = cursor++;
+        if (!current->removed) {
+            if (slice.expired()) {
+                cursor = current;
+                break;
+            }
+
+            ++executed;
+            if (current->job(slice)) current->removed = true;
+        }
+
+        // the job function is destroyed only after it returned
+        if (current->removed) jobs.erase(current);
+    }
+
+    return executed;
+}
+
+std::size_t WorkSlicer::wait_and_run() {
+    sequence = broadcast.wait_for_tick(sequence);
+    return run_slice();
+}
+
+std::size_t WorkSlicer::size() const noexcept {
+    return static_cast<std::size_t>(
+            std::count_if(jobs.begin(), jobs.end(), [](const Job &job) { return !job.removed; }));
+}
+
+}  // namespace cxxitimer
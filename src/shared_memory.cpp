@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "shared_memory.hpp"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace cxxitimer {
+
+SharedMemory::SharedMemory(std::string name, std::size_t size, bool create, mode_t mode)
+    : SharedMemory(std::move(name),
+                   size,
+                   create ? O_RDWR | O_CREAT | O_EXCL : O_RDONLY,
+                   create ? PROT_READ | PROT_WRITE : PROT_READ,
+                   mode,
+                   create) {}
+
+SharedMemory::SharedMemory(std::string _name, std::size_t _size, int open_flags, int prot, mode_t mode, bool _owner)
+    : name(std::move(_name)), size(_size), owner(_owner) {
+    int fd = shm_open(name.c_str(), open_flags, mode);
+    if (fd < 0 && errno == EEXIST)
+        throw std::system_error(EEXIST, std::generic_category(), "shared memory object already exists");
+    if (fd < 0) throw std::system_error(errno, std::generic_category(), "call of shm_open failed");
+
+    if (owner) {
+        if (ftruncate(fd, static_cast<off_t>(size))) {
+            const int error = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            throw std::system_error(error, std::generic_category(), "call of ftruncate failed");
+        }
+    } else {
+        struct stat st {};
+        if (fstat(fd, &st)) {
+            const int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "call of fstat failed");
+        }
+
+        if (static_cast<std::size_t>(st.st_size) < size) {
+            close(fd);
+            throw std::runtime_error("shared memory object too small");
+        }
+    }
+
+    addr = mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        addr = nullptr;
+        if (owner) shm_unlink(name.c_str());
+        throw std::system_error(error, std::generic_category(), "call of mmap failed");
+    }
+}
+
+SharedMemory SharedMemory::open(const std::string &name, std::size_t size, bool writable) {
+    return {name, size, writable ? O_RDWR : O_RDONLY, writable ? PROT_READ | PROT_WRITE : PROT_READ, 0, false};
+}
+
+SharedMemory::SharedMemory(SharedMemory &&other) noexcept
+    : name(std::move(other.name)), size(other.size), addr(other.addr), owner(other.owner) {
+    other.addr  = nullptr;
+    other.owner = false;
+}
+
+SharedMemory::~SharedMemory() {
+    if (addr) munmap(addr, size);
+    if (owner) shm_unlink(name.c_str());
+}
+
+}  // namespace cxxitimer
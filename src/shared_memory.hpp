@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <sched.h>
+#include <string>
+#include <sys/types.h>
+
+namespace cxxitimer {
+
+/**
+ * @brief class SharedMemory
+ * @details internal use only! posix shared memory object that is mapped into the process
+ */
+class SharedMemory {
+private:
+    //* name of the shared memory object
+    std::string name;
+
+    //* size of the mapping
+    std::size_t size;
+
+    //* mapped memory
+    void *addr = nullptr;
+
+    //* object was created by this instance (unlinked on destruction)
+    bool owner;
+
+public:
+    /**
+     * @brief create (owner) or open shared memory object and map it
+     * @param name name of the shared memory object (see man shm_open)
+     * @param size size of the shared memory object
+     * @param create create the object (read/write mapping, must not exist). Opened read only otherwise.
+     * @param mode permissions of the created object
+     * @exception std::system_error object already exists (EEXIST) or call of shm_open, ftruncate, fstat or mmap failed
+     * @exception std::runtime_error shared memory object too small
+     */
+    SharedMemory(std::string name, std::size_t size, bool create, mode_t mode = 0644);
+
+    /**
+     * @brief open existing shared memory object and map it
+     * @param name name of the shared memory object (see man shm_open)
+     * @param size size of the shared memory object
+     * @param writable map read/write instead of read only
+     * @exception std::system_error call of shm_open, fstat or mmap failed
+     * @exception std::runtime_error shared memory object too small
+     */
+    static SharedMemory open(const std::string &name, std::size_t size, bool writable);
+
+    //* unmap (and unlink if owner)
+    ~SharedMemory();
+
+    SharedMemory(const SharedMemory &other)            = delete;
+    SharedMemory &operator=(const SharedMemory &other) = delete;
+    SharedMemory &operator=(SharedMemory &&other)      = delete;
+
+    SharedMemory(SharedMemory &&other) noexcept;
+
+    //* get mapped memory
+    [[nodiscard]] inline void *get_addr() const noexcept { return addr; }
+
+private:
+    SharedMemory(std::string name, std::size_t size, int open_flags, int prot, mode_t mode, bool owner);
+};
+
+/**
+ * @brief internal use only! read data that is protected by a seqlock
+ * @details
+ * Retries until a consistent copy was read. The reader never blocks the writer (async signal safe).
+ * @param seqlock sequence word (odd: write in progress)
+ * @param read copies the protected data (relaxed loads only)
+ */
+template <typename Read>
+void seqlock_read(const std::atomic<std::uint32_t> &seqlock, Read &&read) noexcept {
+    std::uint32_t seq_begin = 0;
+    std::uint32_t seq_end   = 0;
+
+    do {
+        seq_begin = seqlock.load(std::memory_order_acquire);
+        if (seq_begin & 1U) continue;
+
+        read();
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seq_end = seqlock.load(std::memory_order_relaxed);
+    } while ((seq_begin & 1U) || seq_begin != seq_end);
+}
+
+/**
+ * @brief internal use only! try to start a write section of a seqlock
+ * @details
+ * The sequence word is made odd by a compare and swap.
+ * Therefore, writers are serialized across threads and processes that share the sequence word.
+ * @param seqlock sequence word
+ * @param seq sequence word before the write section (valid if true is returned)
+ * @return true write section started (finish with seqlock_write_end)
+ * @return false another write section is in progress
+ */
+inline bool seqlock_try_write_begin(std::atomic<std::uint32_t> &seqlock, std::uint32_t &seq) noexcept {
+    seq = seqlock.load(std::memory_order_relaxed);
+    if ((seq & 1U) || !seqlock.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire)) return false;
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief internal use only! start a write section of a seqlock
+ * @details waits (yields) until the write sections of other writers are finished
+ * @param seqlock sequence word
+ * @return sequence word before the write section
+ */
+inline std::uint32_t seqlock_write_begin(std::atomic<std::uint32_t> &seqlock) noexcept {
+    std::uint32_t seq = 0;
+    while (!seqlock_try_write_begin(seqlock, seq))
+        sched_yield();
+    return seq;
+}
+
+/**
+ * @brief internal use only! finish a write section of a seqlock
+ * @param seqlock sequence word
+ * @param seq sequence word before the write section
+ */
+inline void seqlock_write_end(std::atomic<std::uint32_t> &seqlock, std::uint32_t seq) noexcept {
+    seqlock.store(seq + 2, std::memory_order_release);
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <sys/time.h>
+
+namespace cxxitimer {
+
+//* internal use only! number of nsec per second
+inline constexpr std::int64_t NSEC_PER_SEC = 1000000000;
+
+//* internal use only! number of nsec per usec
+inline constexpr std::int64_t NSEC_PER_USEC = 1000;
+
+/**
+ * @brief internal use only! read a clock
+ * @details async signal safe
+ * @param clock clock id
+ * @return current time of the clock (nsec)
+ */
+inline std::int64_t clock_nsec(clockid_t clock) noexcept {
+    timespec now {};
+    clock_gettime(clock, &now);
+    return std::int64_t {now.tv_sec} * NSEC_PER_SEC + now.tv_nsec;
+}
+
+//* internal use only! current time of CLOCK_MONOTONIC (nsec, async signal safe)
+inline std::int64_t monotonic_nsec() noexcept {
+    return clock_nsec(CLOCK_MONOTONIC);
+}
+
+//* internal use only! cpu time of the process (nsec, async signal safe)
+inline std::int64_t process_cpu_nsec() noexcept {
+    return clock_nsec(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+/**
+ * @brief internal use only! convert nsec to timespec
+ * @param nsec time (nsec, >= 0)
+ * @return timespec
+ */
+inline timespec nsec_to_timespec(std::int64_t nsec) noexcept {
+    timespec ret_val {};
+    ret_val.tv_sec  = nsec / NSEC_PER_SEC;
+    ret_val.tv_nsec = nsec % NSEC_PER_SEC;
+    return ret_val;
+}
+
+/**
+ * @brief internal use only! convert timeval to nsec
+ * @param time time
+ * @return time (nsec)
+ */
+inline std::int64_t timeval_to_nsec(const timeval &time) noexcept {
+    return std::int64_t {time.tv_sec} * NSEC_PER_SEC + std::int64_t {time.tv_usec} * NSEC_PER_USEC;
+}
+
+/**
+ * @brief internal use only! convert nsec to timeval
+ * @details truncated to usec
+ * @param nsec time (nsec, >= 0)
+ * @return timeval
+ */
+inline timeval nsec_to_timeval(std::int64_t nsec) noexcept {
+    timeval ret_val {};
+    ret_val.tv_sec  = nsec / NSEC_PER_SEC;
+    ret_val.tv_usec = (nsec % NSEC_PER_SEC) / NSEC_PER_USEC;
+    return ret_val;
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "unix_socket.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace cxxitimer {
+
+namespace {
+
+/**
+ * @brief check if a socket file is stale
+ * @param address socket address
+ * @param type socket type
+ * @return true no socket is bound to the file (connection refused)
+ * @return false socket in use (or probe failed)
+ */
+bool is_stale(const sockaddr_un &address, int type) noexcept {
+    const int probe = socket(AF_UNIX, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (probe < 0) return false;
+
+    int result = 0;
+    do {
+        result = connect(probe, reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+    } while (result != 0 && errno == EINTR);
+    const bool stale = result != 0 && errno == ECONNREFUSED;
+
+    close(probe);
+    return stale;
+}
+
+}  // namespace
+
+sockaddr_un make_unix_address(const std::string &path) {
+    sockaddr_un address {};
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) throw std::invalid_argument("invalid socket path");
+
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+int bind_unix_socket(const std::string &path, int type, dev_t &dev, ino_t &ino) {
+    const auto address = make_unix_address(path);
+
+    // replace only a stale socket, never another file or a socket in use
+    struct stat st {};
+    if (lstat(path.c_str(), &st) == 0) {
+        if (!S_ISSOCK(st.st_mode))
+            throw std::system_error(EADDRINUSE, std::generic_category(), "socket path exists and is not a socket");
+        if (!is_stale(address, type))
+            throw std::system_error(EADDRINUSE, std::generic_category(), "socket path is in use");
+        unlink(path.c_str());
+    }
+
+    const int fd = socket(AF_UNIX, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw std::system_error(errno, std::generic_category(), "call of socket failed");
+
+    if (bind(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address))) {
+        const int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "call of bind failed");
+    }
+
+    // remember the socket file: the destructor must not remove a file of another process
+    if (lstat(path.c_str(), &st)) {
+        const int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "call of stat failed");
+    }
+
+    dev = st.st_dev;
+    ino = st.st_ino;
+    return fd;
+}
+
+void unlink_unix_socket(const std::string &path, dev_t dev, ino_t ino) noexcept {
+    struct stat st {};
+    if (lstat(path.c_str(), &st) == 0 && st.st_dev == dev && st.st_ino == ino) unlink(path.c_str());
+}
+
+}  // namespace cxxitimer
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <string>
+#include <sys/types.h>
+#include <sys/un.h>
+
+namespace cxxitimer {
+
+/**
+ * @brief internal use only! create the address of a UNIX domain socket
+ * @param path socket path
+ * @return socket address
+ * @exception std::invalid_argument socket path empty or too long
+ */
+sockaddr_un make_unix_address(const std::string &path);
+
+/**
+ * @brief internal use only! create a UNIX domain socket and bind it to a path
+ * @details
+ * An existing socket at path is only replaced if it is stale: a connection attempt is refused (ECONNREFUSED), i.e.
+ * no socket of a running process is bound to it. Other files and sockets in use are never replaced.
+ *
+ * The device and inode of the created socket file are returned to remove it with unlink_unix_socket().
+ * @param path socket path
+ * @param type socket type (SOCK_STREAM or SOCK_DGRAM, created with SOCK_NONBLOCK and SOCK_CLOEXEC)
+ * @param dev device of the socket file
+ * @param ino inode of the socket file
+ * @return socket file descriptor
+ * @exception std::invalid_argument socket path empty or too long
+ * @exception std::system_error path exists and is not a stale socket (EADDRINUSE) or call of socket, bind or stat
+ *            failed
+ */
+int bind_unix_socket(const std::string &path, int type, dev_t &dev, ino_t &ino);
+
+/**
+ * @brief internal use only! remove a socket file that was created by bind_unix_socket()
+ * @details the file is not removed if path refers to another file (e.g. replaced by another process)
+ * @param path socket path
+ * @param dev device of the socket file
+ * @param ino inode of the socket file
+ */
+void unlink_unix_socket(const std::string &path, dev_t dev, ino_t ino) noexcept;
+
+}  // namespace cxxitimer
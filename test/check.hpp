@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+//* return EXIT_FAILURE from the calling function if cond is false
+#define CHECK(cond)                                                                                                    \
+    do {                                                                                                               \
+        if (!(cond)) {                                                                                                 \
+            std::cerr << "Assertion " #cond " failed " << __FILE__ << ":" << __LINE__ << '\n';                         \
+            return EXIT_FAILURE;                                                                                       \
+        }                                                                                                              \
+    } while (false)
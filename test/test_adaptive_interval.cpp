@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_adaptive_interval.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+
+using namespace std::chrono_literals;
+
+//* compare periods
+static bool period_is(const cxxitimer::AdaptiveInterval &controller, double period) {
+    return std::fabs(controller.get_period() - period) < 1e-9;
+}
+
+static cxxitimer::AdaptiveInterval::Parameters make_parameters() {
+    cxxitimer::AdaptiveInterval::Parameters parameters;
+    parameters.min_period = 0.005;
+    parameters.max_period = 0.04;
+    parameters.window     = 2;
+    return parameters;
+}
+
+static int test_adjustment() {
+    cxxitimer::ITimer_Virtual   timer(0.01);
+    cxxitimer::AdaptiveInterval controller(timer, make_parameters());
+    CHECK(period_is(controller, 0.01));
+
+    // evaluated after a complete window: idle --> lengthen
+    CHECK(!controller.record(0ms));
+    CHECK(controller.record(0ms));
+    CHECK(period_is(controller, 0.0125));
+
+    // overload --> lengthen
+    controller.record(12ms);
+    CHECK(controller.record(12ms));
+    CHECK(period_is(controller, 0.015625));
+
+    // backlog --> shorten
+    controller.record(5ms, 3);
+    CHECK(controller.record(5ms));
+    CHECK(period_is(controller, 0.0125));
+
+    // moderate load without backlog --> unchanged
+    controller.record(5ms);
+    CHECK(!controller.record(5ms));
+    CHECK(period_is(controller, 0.0125));
+
+    // clamped to the bounds
+    for (int i = 0; i < 20; ++i)
+        controller.record(0ms);
+    CHECK(period_is(controller, 0.04));
+    controller.record(0ms);
+    CHECK(!controller.record(0ms));
+
+    for (int i = 0; i < 40; ++i)
+        controller.record(0ms, 1);
+    CHECK(period_is(controller, 0.005));
+    controller.record(0ms, 1);
+    CHECK(!controller.record(0ms, 1));
+
+    return EXIT_SUCCESS;
+}
+
+static int test_coalescing() {
+    // ticks are not handled in this test
+    signal(SIGALRM, SIG_IGN);
+
+    cxxitimer::ITimer_Real timer(0.01);
+    timer.set_speed_coalescing(10.0);
+    timer.start();
+
+    // the first change is applied, the following ones are coalesced: each adjustment starts from the pending period
+    cxxitimer::AdaptiveInterval controller(timer, make_parameters());
+    for (int i = 0; i < 6; ++i)
+        controller.record(0ms);
+    CHECK(timer.has_pending_speed_factor());
+    CHECK(period_is(controller, 0.01 * 1.25 * 1.25 * 1.25));
+
+    timer.stop();
+    CHECK(period_is(controller, 0.01 * 1.25 * 1.25 * 1.25));
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_adjustment() == EXIT_SUCCESS);
+    CHECK(test_coalescing() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
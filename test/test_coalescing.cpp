@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <thread>
+
+int main() {
+    // ticks are not handled in this test
+    signal(SIGALRM, SIG_IGN);
+
+    cxxitimer::ITimer_Real timer(0.005);
+    timer.set_speed_coalescing(0.05);
+    timer.start();
+
+    // first change is applied directly, the following ones are coalesced
+    timer.set_speed_factor(2.0);
+    CHECK(!timer.has_pending_speed_factor());
+    timer.set_speed_factor(3.0);
+    timer.set_speed_factor(4.0);
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 2.0));
+    CHECK(!std::islessgreater(timer.get_pending_speed_factor(), 4.0));
+
+    // the last change is applied on an expiration after the coalescing period without further calls
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (timer.has_pending_speed_factor() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK(!timer.has_pending_speed_factor());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 4.0));
+    CHECK(timer.is_running());
+
+    // disabling coalescing applies a recorded change immediately
+    timer.set_speed_coalescing(10.0);
+    timer.set_speed_factor(1.0);
+    CHECK(!std::islessgreater(timer.get_pending_speed_factor(), 1.0));
+    timer.set_speed_coalescing(0.0);
+    CHECK(!timer.has_pending_speed_factor());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 1.0));
+
+    // stop() applies a recorded change
+    timer.set_speed_coalescing(10.0);
+    timer.set_speed_factor(0.5);
+    CHECK(timer.has_pending_speed_factor());
+    timer.stop();
+    CHECK(!timer.has_pending_speed_factor());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 0.5));
+
+    return EXIT_SUCCESS;
+}
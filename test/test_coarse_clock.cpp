@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_coarse_clock.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+int main() {
+    // ticks are simulated with raise
+    signal(SIGALRM, SIG_IGN);
+
+    cxxitimer::ITimer_Real timer(0.01);
+    CHECK(cxxitimer::CoarseClock::now().time_since_epoch().count() == 0);
+
+    {
+        cxxitimer::CoarseClock clock(timer);
+
+        // the time is cached on creation
+        const auto created = cxxitimer::CoarseClock::now();
+        CHECK(std::chrono::system_clock::now() - created < 1s);
+        CHECK(cxxitimer::CoarseClock::now_timeval().tv_sec ==
+              std::chrono::duration_cast<std::chrono::seconds>(created.time_since_epoch()).count());
+
+        // the cached time only advances on a tick
+        std::this_thread::sleep_for(20ms);
+        CHECK(cxxitimer::CoarseClock::now() == created);
+        raise(SIGALRM);
+        CHECK(cxxitimer::CoarseClock::now() - created >= 20ms);
+
+        bool thrown = false;
+        try {
+            cxxitimer::CoarseClock other(timer);
+        } catch (const std::logic_error &) { thrown = true; }
+        CHECK(thrown);
+    }
+
+    // no instance: epoch, a new instance can be created
+    CHECK(cxxitimer::CoarseClock::now().time_since_epoch().count() == 0);
+    cxxitimer::CoarseClock clock(timer);
+    CHECK(cxxitimer::CoarseClock::now().time_since_epoch().count() != 0);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_deadline.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+//* execute expired timers until the future is ready (at most 2 s)
+template <typename T>
+static bool dispatch_until_ready(cxxitimer::QueueDispatcher &dispatcher, const std::future<T> &future) {
+    const auto end = std::chrono::steady_clock::now() + 2s;
+    while (future.wait_for(0s) != std::future_status::ready) {
+        if (std::chrono::steady_clock::now() >= end) return false;
+        dispatcher.wait_and_dispatch({0, 10000});
+    }
+    return true;
+}
+
+//* check if the future holds a timeout_error
+template <typename T>
+static bool is_timeout(std::future<T> &future) {
+    try {
+        future.get();
+    } catch (const cxxitimer::timeout_error &) { return true; }
+    return false;
+}
+
+static int test_value_and_exception(cxxitimer::QueueDispatcher &dispatcher) {
+    // value before the timeout: the timeout timer is canceled
+    cxxitimer::DeadlinePromise<int> promise(dispatcher, 1s);
+    auto                            future = promise.get_future();
+    CHECK(dispatcher.size() == 1);
+    CHECK(promise.set_value(42));
+    CHECK(!promise.set_value(43));
+    CHECK(promise.is_completed());
+    CHECK(dispatcher.size() == 0);
+    CHECK(future.get() == 42);
+
+    // exception
+    auto [failing, failing_future] = cxxitimer::with_timeout<std::string>(dispatcher, 1s);
+    CHECK(failing.set_exception(std::make_exception_ptr(std::logic_error("failed"))));
+    CHECK(!failing.set_value("late"));
+    bool thrown = false;
+    try {
+        failing_future.get();
+    } catch (const std::logic_error &) { thrown = true; }
+    CHECK(thrown);
+
+    return EXIT_SUCCESS;
+}
+
+static int test_timeout(cxxitimer::QueueDispatcher &dispatcher) {
+    auto [promise, future] = cxxitimer::with_timeout<void>(dispatcher, 20ms);
+    CHECK(dispatch_until_ready(dispatcher, future));
+    CHECK(promise.is_completed());
+    CHECK(!promise.set_value());
+    CHECK(is_timeout(future));
+    return EXIT_SUCCESS;
+}
+
+static int test_when_any(cxxitimer::QueueDispatcher &dispatcher) {
+    using producer_t = std::function<void(cxxitimer::DeadlinePromise<std::string>)>;
+
+    // the first completion wins
+    std::vector<producer_t> producers;
+    std::vector<bool>       accepted;
+    for (const auto *name : {"a", "b", "c"})
+        producers.emplace_back([&accepted, name](auto promise) { accepted.push_back(promise.set_value(name)); });
+
+    auto future = cxxitimer::when_any_or_timeout<std::string>(dispatcher, 1s, producers);
+    CHECK((accepted == std::vector<bool> {true, false, false}));
+    CHECK(future.get() == "a");
+    CHECK(dispatcher.size() == 0);
+
+    // no producer completes
+    std::vector<producer_t> silent(2, [](const auto &) {});
+    auto                    timeout_future = cxxitimer::when_any_or_timeout<std::string>(dispatcher, 20ms, silent);
+    CHECK(dispatch_until_ready(dispatcher, timeout_future));
+    CHECK(is_timeout(timeout_future));
+
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    cxxitimer::ITimer_Real       timer;
+    cxxitimer::OrderedTimerQueue queue;
+    cxxitimer::QueueDispatcher   dispatcher(timer, queue);
+
+    CHECK(test_value_and_exception(dispatcher) == EXIT_SUCCESS);
+    CHECK(test_timeout(dispatcher) == EXIT_SUCCESS);
+    CHECK(test_when_any(dispatcher) == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
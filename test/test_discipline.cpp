@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_discipline.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
+//* the expirations of the timer are 0.2% late relative to the reference time source
+static constexpr double DRIFT = 1.002;
+
+static int test_speed_discipline() {
+    // the timer is not started: the expirations are simulated in reference time
+    cxxitimer::ITimer_Virtual timer(0.01);
+    double                    reference_time = 1e12;
+
+    cxxitimer::SpeedDiscipline discipline(
+            timer, [&reference_time]() -> std::optional<std::int64_t> { return std::llround(reference_time); });
+
+    // the tick count wraps during the test
+    std::uint32_t tick_count = UINT32_MAX - 100;
+    CHECK(!discipline.update(tick_count));
+
+    for (int i = 0; i < 5000; ++i) {
+        reference_time += 0.01 * 1e9 * DRIFT / timer.get_speed_factor();
+        CHECK(discipline.update(++tick_count));
+        CHECK(std::abs(discipline.get_phase_error()) < 0.01);
+    }
+
+    // locked: the speed factor compensates the drift, the phase error is removed
+    CHECK(std::abs(timer.get_speed_factor() - DRIFT) < 1e-4);
+    CHECK(std::abs(discipline.get_phase_error()) < 1e-5);
+
+    // unavailable reference
+    discipline.reset();
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 1.0));
+    CHECK(!cxxitimer::SpeedDiscipline(timer, [] { return std::optional<std::int64_t>(); }).update(0));
+
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_speed_discipline() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+int main() {
+    cxxitimer::ITimer_Virtual timer(1.0);
+    std::error_code           ec;
+
+    // speed factor is checked and not changed on error
+    timer.set_speed_factor(-1.0, ec);
+    CHECK(ec == cxxitimer::timer_errc::negative_speed_factor);
+    timer.set_speed_factor(std::numeric_limits<double>::quiet_NaN(), ec);
+    CHECK(ec == cxxitimer::timer_errc::invalid_speed_factor);
+    timer.set_speed_factor(std::numeric_limits<double>::infinity(), ec);
+    CHECK(ec == cxxitimer::timer_errc::invalid_speed_factor);
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 1.0));
+
+    timer.set_speed_factor(2.0, ec);
+    CHECK(!ec);
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 2.0));
+
+    // start and stop
+    timer.stop(ec);
+    CHECK(ec == cxxitimer::timer_errc::already_stopped);
+    timer.start(ec);
+    CHECK(!ec);
+    timer.start(ec);
+    CHECK(ec == cxxitimer::timer_errc::already_started);
+    timer.stop(ec);
+    CHECK(!ec);
+    CHECK(!timer.is_running());
+
+    // the speed factor scales the interval to 0
+    timer.set_speed_factor(1e9, ec);
+    CHECK(!ec);
+    timer.start(ec);
+    CHECK(ec == cxxitimer::timer_errc::interval_too_small);
+    CHECK(!timer.is_running());
+    timer.set_speed_to_normal(ec);
+    CHECK(!ec);
+
+    // the throwing functions map the error codes to exceptions
+    bool thrown = false;
+    try {
+        timer.set_speed_factor(-1.0);
+    } catch (const std::invalid_argument &) { thrown = true; }
+    CHECK(thrown);
+
+    // write errors are reported via the error code, even if the stream throws on errors
+    std::ofstream file;
+    file.exceptions(std::ios::badbit | std::ios::failbit);
+    timer.to_fstream(file, ec);
+    CHECK(ec == std::io_errc::stream);
+
+    thrown = false;
+    try {
+        timer.to_fstream(file);
+    } catch (const std::system_error &) { thrown = true; }
+    CHECK(thrown);
+
+    std::ofstream quiet;
+    timer.to_fstream(quiet, ec);
+    CHECK(ec == std::io_errc::stream);
+
+    return EXIT_SUCCESS;
+}
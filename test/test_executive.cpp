@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+#include "cxxitimer_executive.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <string>
+
+//* simulate expirations of the timer
+static void expire(int count) {
+    for (int i = 0; i < count; ++i)
+        raise(SIGALRM);
+}
+
+int main() {
+    // expirations are simulated in this test
+    signal(SIGALRM, SIG_IGN);
+
+    cxxitimer::ITimer_Real   timer(0.01);
+    cxxitimer::RateExecutive executive(timer);
+    std::string              log;
+
+    executive.add_task(4, [&log] { log += 'C'; });
+    executive.add_task(2, [&log] { log += 'B'; }, 1);
+    executive.add_task(1, [&log] { log += 'A'; });
+
+    // expirations before the build are not caught up
+    expire(3);
+    executive.build();
+    CHECK(executive.get_hyperperiod() == 4);
+
+    // slot table in rate monotonic order
+    for (int i = 0; i < 4; ++i) {
+        expire(1);
+        CHECK(executive.wait_and_run() == 1);
+        log += '|';
+    }
+    CHECK(log == "AC|AB|A|AB|");
+    CHECK(executive.get_overruns() == 0);
+
+    // missed expirations are caught up and counted
+    log.clear();
+    expire(3);
+    CHECK(executive.wait_and_run() == 3);
+    CHECK(log == "ACABA");
+    CHECK(executive.get_overruns() == 2);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_fixed_step.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+static int test_advance() {
+    // the timer is not started: the elapsed time is passed directly
+    cxxitimer::ITimer_Real timer(0.01);
+    unsigned               step_calls = 0;
+    std::vector<double>    alphas;
+
+    cxxitimer::FixedStepLoop loop(
+            timer, 0.25, [&step_calls](double) { ++step_calls; }, [&alphas](double a) { alphas.push_back(a); }, 3);
+
+    // partial step remains in the accumulator
+    CHECK(loop.advance(0.625) == 2);
+    CHECK(!std::islessgreater(loop.get_alpha(), 0.5));
+    CHECK(loop.advance(0.125) == 1);
+    CHECK(!std::islessgreater(loop.get_alpha(), 0.0));
+    CHECK(!std::islessgreater(loop.get_simulation_time(), 0.75));
+
+    // overload: at most 3 steps, the time that cannot be caught up is dropped (the partial step is kept)
+    CHECK(loop.advance(2.0625) == 3);
+    CHECK(!std::islessgreater(loop.get_dropped_time(), 1.25));
+    CHECK(!std::islessgreater(loop.get_alpha(), 0.25));
+
+    // negative time is ignored
+    CHECK(loop.advance(-1.0) == 0);
+    CHECK(!std::islessgreater(loop.get_alpha(), 0.25));
+
+    CHECK(loop.get_steps() == 6);
+    CHECK(step_calls == 6);
+    CHECK((alphas == std::vector<double> {0.5, 0.0, 0.25, 0.25}));
+
+    // invalid arguments
+    int thrown = 0;
+    try {
+        cxxitimer::FixedStepLoop invalid(timer, 0.0, [](double) {});
+    } catch (const std::invalid_argument &) { ++thrown; }
+    try {
+        cxxitimer::FixedStepLoop invalid(timer, 0.1, [](double) {}, {}, 0);
+    } catch (const std::invalid_argument &) { ++thrown; }
+    try {
+        cxxitimer::FixedStepLoop invalid(timer, 0.1, {});
+    } catch (const std::invalid_argument &) { ++thrown; }
+    CHECK(thrown == 3);
+
+    return EXIT_SUCCESS;
+}
+
+static int test_wait_and_run() {
+    // speed factor 2: the simulation runs twice as fast as real time
+    cxxitimer::ITimer_Real   timer(0.01);
+    const auto               start = std::chrono::steady_clock::now();
+    cxxitimer::FixedStepLoop loop(timer, 0.01, [](double) {});
+    timer.set_speed_factor(2.0);
+    timer.start();
+
+    for (int i = 0; i < 20; ++i)
+        loop.wait_and_run();
+    timer.stop();
+
+    const auto real  = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const auto total = loop.get_simulation_time() + loop.get_alpha() * 0.01 + loop.get_dropped_time();
+    CHECK(loop.get_steps() > 0);
+    CHECK(total > 2.0 * 0.09 && total <= 2.0 * real + 0.001);
+
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_advance() == EXIT_SUCCESS);
+    CHECK(test_wait_and_run() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//* check whether the kernel timer is armed
+static bool armed(int type) {
+    itimerval val {};
+    getitimer(type, &val);
+    return val.it_value.tv_sec != 0 || val.it_value.tv_usec != 0;
+}
+
+//* run a function in a child process and return its exit code
+template <typename F>
+static int in_child(F function) {
+    const auto pid = fork();
+    if (pid == 0) _exit(function());
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+}
+
+int main() {
+    // ticks are not handled in this test
+    signal(SIGALRM, SIG_IGN);
+
+    auto timer = std::make_unique<cxxitimer::ITimer_Real>(0.5);
+    timer->start();
+
+    // default: stopped in the child, can be started or replaced
+    CHECK(in_child([&timer] {
+              CHECK(!timer->is_running());
+              CHECK(!armed(ITIMER_REAL));
+              timer->start();
+              CHECK(armed(ITIMER_REAL));
+              timer.reset();
+              cxxitimer::ITimer_Real new_timer(0.1);
+              new_timer.start();
+              CHECK(armed(ITIMER_REAL));
+              return EXIT_SUCCESS;
+          }) == EXIT_SUCCESS);
+
+    timer->set_fork_policy(cxxitimer::ForkPolicy::restart);
+    CHECK(in_child([&timer] {
+              CHECK(timer->is_running());
+              CHECK(armed(ITIMER_REAL));
+              timer->stop();
+              return EXIT_SUCCESS;
+          }) == EXIT_SUCCESS);
+
+    // the child keeps the phase of the parent
+    timer->set_fork_policy(cxxitimer::ForkPolicy::resume);
+    CHECK(in_child([&timer] {
+              CHECK(timer->is_running());
+              const auto value = cxxitimer::timeval_to_double(timer->get_timer_value());
+              CHECK(value > 0.0 && value < 0.5);
+              timer->stop();
+              return EXIT_SUCCESS;
+          }) == EXIT_SUCCESS);
+
+    // a recorded (coalesced) speed factor is applied by the restarted timer
+    timer->set_speed_coalescing(10.0);
+    timer->set_speed_factor(2.0);
+    timer->set_speed_factor(4.0);
+    CHECK(timer->has_pending_speed_factor());
+    timer->set_fork_policy(cxxitimer::ForkPolicy::restart);
+    CHECK(in_child([&timer] {
+              CHECK(!timer->has_pending_speed_factor());
+              CHECK(!std::islessgreater(timer->get_speed_factor(), 4.0));
+              itimerval val {};
+              getitimer(ITIMER_REAL, &val);
+              CHECK(val.it_interval.tv_sec == 0 && val.it_interval.tv_usec == 125000);
+              timer->stop();
+              return EXIT_SUCCESS;
+          }) == EXIT_SUCCESS);
+    timer->set_speed_coalescing(0.0);
+
+    // parent is not affected
+    CHECK(timer->is_running());
+    CHECK(armed(ITIMER_REAL));
+    timer->stop();
+
+    return EXIT_SUCCESS;
+}
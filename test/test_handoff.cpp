@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <unistd.h>
+
+static volatile sig_atomic_t ticks = 0;
+static void                  handler(int) {
+    ++ticks;
+}
+
+//* second process image: adopt the running timer
+static int adopted() {
+    // signal must still be blocked
+    sigset_t mask;
+    sigprocmask(SIG_BLOCK, nullptr, &mask);
+    CHECK(sigismember(&mask, SIGALRM));
+
+    cxxitimer::ITimer_Real timer(cxxitimer::adopt_handoff, 1.0);
+    CHECK(timer.is_running());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 2.0));
+    CHECK(timer.get_interval().tv_sec == 0 && timer.get_interval().tv_usec == 20000);
+    CHECK(getenv("CXXITIMER_HANDOFF_REAL") == nullptr);
+
+    // phase is kept: the first expiration (0.25 s after start) is still pending
+    const auto value = cxxitimer::timeval_to_double(timer.get_timer_value());
+    CHECK(value > 0.0 && value < 0.25);
+
+    struct sigaction sa {};
+    sa.sa_handler = handler;
+    sigaction(SIGALRM, &sa, nullptr);
+    sigprocmask(SIG_UNBLOCK, &mask, nullptr);
+
+    // 10 ticks are expected after at most 0.35 s (first expiration + 9 periods of 10 ms)
+    timespec start {};
+    timespec now {};
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        pause();
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((now.tv_sec - start.tv_sec) * 1000000000 + now.tv_nsec - start.tv_nsec < 1000000000 && ticks < 10);
+    timer.stop();
+
+    CHECK(ticks >= 10);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) return adopted();
+
+    cxxitimer::ITimer_Real timer(0.02, 0.5);
+    timer.set_speed_factor(2.0);
+    timer.start();
+
+    timer.prepare_exec_handoff();
+    execl("/proc/self/exe", argv[0], "adopted", nullptr);
+
+    perror("execl");
+    timer.cancel_exec_handoff();
+    return EXIT_FAILURE;
+}
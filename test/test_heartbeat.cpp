@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_heartbeat.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <system_error>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+static int test_phi_accrual() {
+    cxxitimer::PhiAccrualDetector::Parameters parameters;
+    parameters.window            = 10;
+    parameters.min_std_deviation = 0.01;
+
+    cxxitimer::PhiAccrualDetector detector(parameters);
+    CHECK(!std::islessgreater(detector.phi(1s), 0.0));
+
+    // regular heartbeats every 100 ms (the bootstrap estimate leaves the window)
+    std::chrono::nanoseconds time = 1s;
+    for (int i = 0; i < 20; ++i) {
+        detector.heartbeat(time);
+        time += 100ms;
+    }
+    const auto last = detector.get_last_heartbeat();
+    CHECK(detector.get_heartbeat_count() == 20);
+    CHECK(detector.get_mean() > 0.099 && detector.get_mean() < 0.101);
+
+    // phi grows with the time since the last heartbeat: 0.3 at the mean, above any threshold after two periods
+    const auto at_mean = detector.phi(last + 100ms);
+    CHECK(detector.phi(last + 50ms) < 0.01);
+    CHECK(at_mean > 0.29 && at_mean < 0.31);
+    CHECK(detector.phi(last + 110ms) > at_mean);
+    CHECK(detector.phi(last + 200ms) > 8.0);
+
+    // invalid parameters
+    parameters.window = 1;
+    bool thrown       = false;
+    try {
+        cxxitimer::PhiAccrualDetector invalid(parameters);
+    } catch (const std::invalid_argument &) { thrown = true; }
+    CHECK(thrown);
+
+    return EXIT_SUCCESS;
+}
+
+static int test_monitor() {
+    const std::string path = "/tmp/cxxitimer_test_heartbeat_" + std::to_string(getpid());
+
+    // heartbeats are sent manually in this test
+    signal(SIGALRM, SIG_IGN);
+    cxxitimer::ITimer_Real timer(0.01);
+
+    // a file that is not a socket is not replaced
+    std::ofstream(path) << "data";
+    bool thrown = false;
+    try {
+        cxxitimer::HeartbeatMonitor monitor(timer, path, {});
+    } catch (const std::system_error &e) { thrown = e.code() == std::errc::address_in_use; }
+    CHECK(thrown);
+
+    struct stat st {};
+    CHECK(lstat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode));
+    CHECK(unlink(path.c_str()) == 0);
+
+    // a stale socket (no process bound to it) is replaced
+    const int stale = socket(AF_UNIX, SOCK_DGRAM, 0);
+    CHECK(stale >= 0);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    CHECK(bind(stale, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+    close(stale);
+
+    {
+        cxxitimer::HeartbeatMonitor monitor(timer, path, {});
+        cxxitimer::HeartbeatSender  sender(timer, path, 7);
+
+        // the socket of a running monitor is not replaced
+        thrown = false;
+        try {
+            cxxitimer::HeartbeatMonitor other(timer, path, {});
+        } catch (const std::system_error &e) { thrown = e.code() == std::errc::address_in_use; }
+        CHECK(thrown);
+
+        sender.send();
+        sender.send();
+        CHECK(monitor.receive() == 2);
+        CHECK(monitor.size() == 1);
+        CHECK(!monitor.is_suspected(7));
+        CHECK(monitor.get_phi(7) < 1.0);
+    }
+
+    // the socket is removed with the monitor
+    CHECK(lstat(path.c_str(), &st) != 0 && errno == ENOENT);
+
+    // a file that replaced the socket is not removed with the monitor
+    {
+        cxxitimer::HeartbeatMonitor monitor(timer, path, {});
+        CHECK(unlink(path.c_str()) == 0);
+        std::ofstream(path) << "data";
+    }
+    CHECK(lstat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode));
+    CHECK(unlink(path.c_str()) == 0);
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_phi_accrual() == EXIT_SUCCESS);
+    CHECK(test_monitor() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_introspection.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+static int test_early_ticks() {
+    // ticks are simulated with raise
+    signal(SIGALRM, SIG_IGN);
+
+    cxxitimer::ITimer_Real timer(0.1);
+    cxxitimer::TimerStats  stats(timer);
+    const auto             start = std::chrono::steady_clock::now();
+
+    // first tick defines the phase, the next ticks are early (expected at +100 ms and +200 ms)
+    raise(SIGALRM);
+    std::this_thread::sleep_until(start + 50ms);
+    raise(SIGALRM);
+    std::this_thread::sleep_until(start + 170ms);
+    raise(SIGALRM);
+
+    // an early tick must not move the phase (the last tick would be late by 20 ms otherwise)
+    const auto lateness = stats.get_lateness();
+    CHECK(stats.get_expirations() == 3);
+    CHECK(stats.get_missed() == 0);
+    CHECK(lateness[0] == 2);
+    CHECK(std::accumulate(lateness.begin(), lateness.end(), std::uint64_t {0}) == 2);
+    return EXIT_SUCCESS;
+}
+
+static int test_server() {
+    const std::string path = "/tmp/cxxitimer_test_introspection_" + std::to_string(getpid());
+
+    // a file that is not a socket is not replaced
+    std::ofstream(path) << "data";
+    bool thrown = false;
+    try {
+        cxxitimer::IntrospectionServer invalid(path);
+    } catch (const std::system_error &e) { thrown = e.code() == std::errc::address_in_use; }
+    CHECK(thrown);
+    CHECK(unlink(path.c_str()) == 0);
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    // a stale socket (no process bound to it) is replaced
+    const int stale = socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(stale >= 0);
+    CHECK(bind(stale, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+    close(stale);
+
+    cxxitimer::ITimer_Real         timer(0.005);
+    cxxitimer::TickBroadcast       broadcast(timer);
+    cxxitimer::ITimer_Virtual      queue_timer;
+    cxxitimer::OrderedTimerQueue   queue;
+    cxxitimer::QueueDispatcher     dispatcher(queue_timer, queue);
+    cxxitimer::IntrospectionServer server(path);
+    server.add_timer("tick", timer);
+    server.add_timer("cpu", queue_timer);
+    server.add_queue("work", dispatcher);
+
+    // the socket of a running server is not replaced
+    thrown = false;
+    try {
+        cxxitimer::IntrospectionServer other(path);
+    } catch (const std::system_error &e) { thrown = e.code() == std::errc::address_in_use; }
+    CHECK(thrown);
+    CHECK(server.poll() == 1);  // connection of the liveness check
+
+    dispatcher.schedule_after(std::chrono::hours(1), [] {});
+
+    timer.start();
+    auto seq = broadcast.get_sequence();
+    for (int i = 0; i < 20; ++i)
+        seq = broadcast.wait_for_tick(seq);
+
+    const int client = socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(client >= 0);
+    CHECK(connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+
+    CHECK(server.poll() == 1);
+    timer.stop();
+
+    std::string report;
+    char        buffer[1024];
+    ssize_t     size = 0;
+    while ((size = read(client, buffer, sizeof(buffer))) > 0)
+        report.append(buffer, static_cast<std::size_t>(size));
+    close(client);
+
+    CHECK(report.find("timer tick type=REAL running=1 interval=0.005000") != std::string::npos);
+    CHECK(report.find("lateness tick <1us=") != std::string::npos);
+    CHECK(report.find("timer cpu type=VIRTUAL running=1") != std::string::npos);
+    CHECK(report.find("lateness cpu") == std::string::npos);
+    CHECK(report.find("queue work size=1") != std::string::npos);
+
+    const auto pos         = report.find("expirations=");
+    const auto expirations = std::stoul(report.substr(pos + std::strlen("expirations=")));
+    CHECK(expirations >= 20);
+
+    CHECK(server.poll() == 0);
+    return EXIT_SUCCESS;
+}
+
+static int test_replaced_socket() {
+    const std::string path = "/tmp/cxxitimer_test_introspection_replaced_" + std::to_string(getpid());
+
+    // a file that replaced the socket is not removed with the server
+    {
+        cxxitimer::IntrospectionServer server(path);
+        CHECK(unlink(path.c_str()) == 0);
+        std::ofstream(path) << "data";
+    }
+
+    std::ifstream file(path);
+    std::string   content;
+    file >> content;
+    CHECK(content == "data");
+    CHECK(unlink(path.c_str()) == 0);
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_early_ticks() == EXIT_SUCCESS);
+    CHECK(test_server() == EXIT_SUCCESS);
+    CHECK(test_replaced_socket() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_lease.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+static int test_lease_manager() {
+    cxxitimer::ITimer_Real                timer;
+    cxxitimer::OrderedTimerQueue          queue;
+    cxxitimer::QueueDispatcher            dispatcher(timer, queue);
+    std::vector<std::string>              expired;
+    std::vector<std::chrono::nanoseconds> expired_after;
+    const auto                            start = dispatcher.now();
+
+    cxxitimer::LeaseManager leases(dispatcher, [&](const std::vector<cxxitimer::LeaseManager::Lease> &batch) {
+        for (const auto &lease : batch) {
+            expired.push_back(lease.resource);
+            expired_after.push_back(dispatcher.now() - start);
+        }
+    });
+
+    const auto extended  = leases.acquire("extended", 1, 200ms);
+    const auto shortened = leases.acquire("shortened", 1, 200ms);
+    const auto released  = leases.acquire("released", 1, 200ms);
+    CHECK(extended && shortened && released);
+    CHECK(!leases.acquire("extended", 2, 200ms));
+    CHECK(leases.size() == 3);
+
+    CHECK(leases.renew(*extended, 400ms));
+    CHECK(leases.renew(*shortened, 20ms));
+    CHECK(leases.release(*released));
+    CHECK(!leases.release(*released));
+    CHECK(!leases.renew(*released, 1s));
+    CHECK(!leases.get_lease("released"));
+
+    const auto end = std::chrono::steady_clock::now() + 2s;
+    while (expired.size() < 2 && std::chrono::steady_clock::now() < end) {
+        dispatcher.wait_and_dispatch({0, 10000});
+        leases.flush();
+    }
+
+    // the shortened lease expires without waiting for its original timer, the extended one after its renewal
+    CHECK((expired == std::vector<std::string> {"shortened", "extended"}));
+    CHECK(expired_after[0] >= 20ms && expired_after[0] < 200ms);
+    CHECK(expired_after[1] >= 400ms);
+    CHECK(leases.size() == 0);
+    CHECK(!leases.renew(*shortened, 1s));
+
+    // the resource can be leased by another holder after the expiration
+    CHECK(leases.acquire("extended", 2, 1s));
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_lease_manager() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
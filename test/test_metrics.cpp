@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_metrics.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+static int test_time_series() {
+    cxxitimer::TimeSeries                      series;
+    std::vector<cxxitimer::TimeSeries::Sample> samples;
+
+    // regular timestamps with jitter and occasional gaps, slowly changing and random values
+    std::uint64_t state = 42;
+    auto          ts    = std::chrono::milliseconds(1700000000000);
+    for (int i = 0; i < 1000; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        ts += 1000ms + std::chrono::milliseconds(static_cast<int>(state >> 60) - 8);
+        if (i % 97 == 0) ts += 3600s;
+
+        double value = 0.0;
+        switch (i % 4) {
+            case 0: value = static_cast<double>(i / 10); break;
+            case 1: value = std::sin(static_cast<double>(i) * 0.01) * 100.0; break;
+            case 2: value = static_cast<double>(state >> 11) / 3.0; break;
+            default: value = -0.0; break;
+        }
+
+        series.append(ts, value);
+        samples.push_back({ts, value});
+    }
+    CHECK(series.size() == samples.size());
+
+    const auto all = series.query(samples.front().timestamp, samples.back().timestamp);
+    CHECK(all.size() == samples.size());
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        CHECK(all[i].timestamp == samples[i].timestamp);
+        CHECK(std::memcmp(&all[i].value, &samples[i].value, sizeof(double)) == 0);
+    }
+
+    // range
+    const auto range = series.query(samples[300].timestamp, samples[499].timestamp);
+    CHECK(range.size() == 200);
+    CHECK(range.front().timestamp == samples[300].timestamp);
+    CHECK(range.back().timestamp == samples[499].timestamp);
+
+    CHECK(series.query(samples.back().timestamp + 1ms, samples.back().timestamp + 1s).empty());
+
+    bool thrown = false;
+    try {
+        series.append(samples.back().timestamp - 1ms, 0.0);
+    } catch (const std::invalid_argument &) { thrown = true; }
+    CHECK(thrown);
+
+    return EXIT_SUCCESS;
+}
+
+static int test_compression() {
+    cxxitimer::TimeSeries series(1000);
+
+    auto ts = std::chrono::milliseconds(1700000000000);
+    for (int i = 0; i < 10000; ++i) {
+        ts += 1s;
+        series.append(ts, static_cast<double>(i / 60));
+    }
+
+    // oldest blocks discarded
+    CHECK(series.size() >= 1000);
+    CHECK(series.size() < 1000 + cxxitimer::TimeSeries::SAMPLES_PER_BLOCK);
+    CHECK(series.query(ts - 999s, ts).size() == 1000);
+
+    // constant interval and slowly changing value: about 2 bits per sample + block headers
+    CHECK(series.get_compressed_size() < series.size());
+
+    return EXIT_SUCCESS;
+}
+
+static int test_sampler() {
+    cxxitimer::ITimer_Real     timer(0.01);
+    cxxitimer::MetricSampler   sampler(timer);
+    std::atomic<std::uint64_t> requests {0};
+    std::atomic<double>        load {0.5};
+    sampler.add_counter("requests", requests);
+    sampler.add_gauge("load", load);
+    sampler.add_gauge("constant", [] { return 42.0; });
+
+    timer.start();
+    for (int i = 0; i < 5; ++i) {
+        requests += 10;
+        sampler.wait_and_sample();
+    }
+    timer.stop();
+
+    const auto samples = sampler.query("requests", std::chrono::milliseconds(0), std::chrono::milliseconds::max());
+    CHECK(samples.size() == 5);
+    CHECK(!std::islessgreater(samples.back().value, 50.0));
+    CHECK(sampler.get_names().size() == 3);
+    CHECK(sampler.query("constant", std::chrono::milliseconds(0), std::chrono::milliseconds::max()).size() == 5);
+
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    if (test_time_series() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (test_compression() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (test_sampler() != EXIT_SUCCESS) return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
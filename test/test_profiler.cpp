@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_profile_dump.hpp"
+#include "cxxitimer_profile_windows.hpp"
+#include "cxxitimer_profiler_governor.hpp"
+
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+static volatile double sink = 0.0;
+
+//* consume CPU time
+[[gnu::noinline]] static void burn(double seconds) {
+    const auto start = std::clock();
+    while (static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC < seconds)
+        for (int i = 0; i < 1000; ++i)
+            sink = sink + 1.0;
+}
+
+static int test_profile_windows() {
+    using namespace std::chrono_literals;
+
+    // 3 windows of 60 s
+    cxxitimer::ProfileWindows windows(60s, 3);
+
+    auto make_sample = [](std::int64_t timestamp, std::uintptr_t leaf) {
+        cxxitimer::ProfileSample sample {};
+        sample.timestamp = timestamp;
+        sample.period    = 10000000;
+        sample.depth     = 2;
+        sample.stack[0]  = reinterpret_cast<void *>(leaf);
+        sample.stack[1]  = reinterpret_cast<void *>(0x1000);
+        return sample;
+    };
+
+    constexpr std::int64_t MINUTE = 60000000000;
+
+    // window 0: 75% a, 25% b; window 1: 25% a, 75% b
+    for (int i = 0; i < 100; ++i)
+        windows.add(make_sample(MINUTE + i, i % 4 == 0 ? 0xb : 0xa));
+    for (int i = 0; i < 100; ++i)
+        windows.add(make_sample(2 * MINUTE + i, i % 4 == 0 ? 0xa : 0xb));
+    CHECK(windows.size() == 2);
+
+    const auto diff = windows.diff(1, 0);
+    CHECK(diff.size() == 2);
+    CHECK(std::fabs(diff[0].delta) > 0.49 && std::fabs(diff[0].delta) < 0.51);
+    CHECK(windows.get_stack(diff[0].stack).size() == 2);
+
+    const auto stack_b = cxxitimer::ProfileWindows::hash_stack(make_sample(0, 0xb).stack, 2);
+    for (const auto &entry : diff)
+        if (entry.stack == stack_b) CHECK(entry.delta > 0.0);
+
+    // window without samples, oldest window discarded
+    windows.rotate(3 * MINUTE);
+    windows.add(make_sample(4 * MINUTE, 0xc));
+    CHECK(windows.size() == 3);
+    CHECK(windows.get_window(1).cpu_time.empty());
+    CHECK(windows.get_window(0).total == 10000000);
+
+    // long pause: all windows are replaced by empty windows, their stacks are removed
+    windows.rotate(100 * MINUTE);
+    CHECK(windows.size() == 3);
+    CHECK(windows.get_window(2).cpu_time.empty());
+    CHECK(windows.get_window(0).cpu_time.empty());
+
+    bool thrown = false;
+    try {
+        static_cast<void>(windows.get_stack(stack_b));
+    } catch (const std::out_of_range &) { thrown = true; }
+    CHECK(thrown);
+
+    // a removed stack is stored again with the same id
+    windows.add(make_sample(100 * MINUTE, 0xb));
+    CHECK(windows.get_window(0).cpu_time.count(stack_b) == 1);
+    CHECK(windows.get_stack(stack_b).size() == 2);
+
+    return EXIT_SUCCESS;
+}
+
+static int test_governor() {
+    cxxitimer::ITimer_Prof timer(0.001);
+    cxxitimer::Profiler    profiler(timer);
+
+    // tiny budget: a sample every 1 ms is far too expensive
+    cxxitimer::ProfilerGovernor::Parameters parameters;
+    parameters.budget       = 1e-4;
+    parameters.min_interval = 0.001;
+    parameters.max_interval = 0.05;
+    cxxitimer::ProfilerGovernor governor(timer, profiler, parameters);
+
+    const auto in_bounds = [&](double interval) {
+        return interval > parameters.min_interval - 1e-9 && interval < parameters.max_interval + 1e-9;
+    };
+
+    // the interval is lengthened and stays within the bounds
+    timer.start();
+    burn(0.05);
+    CHECK(governor.update() > parameters.budget);
+    CHECK(timer.get_speed_factor() < 1.0);
+    CHECK(governor.get_interval() > 0.001);
+    CHECK(in_bounds(governor.get_interval()));
+
+    for (int i = 0; i < 3; ++i) {
+        burn(0.1);
+        governor.update();
+        CHECK(in_bounds(governor.get_interval()));
+    }
+
+    // enough budget: the interval is shortened by at most max_increase per update
+    parameters.budget = 0.5;
+    cxxitimer::ProfilerGovernor relaxed(timer, profiler, parameters);
+
+    auto interval = relaxed.get_interval();
+    for (int i = 0; i < 10; ++i) {
+        burn(0.1);
+        relaxed.update();
+
+        const auto next = relaxed.get_interval();
+        CHECK(next <= interval + 1e-9);
+        CHECK(next * parameters.max_increase > interval - 1e-9);
+        CHECK(in_bounds(next));
+        interval = next;
+    }
+    CHECK(interval < parameters.max_interval / parameters.max_increase);
+    timer.stop();
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+    if (test_profile_windows() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (test_governor() != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    cxxitimer::ITimer_Prof timer(0.001);
+    cxxitimer::Profiler    profiler(timer);
+
+    const auto parse = cxxitimer::Profiler::intern_label("stage", "parse");
+
+    timer.start();
+    {
+        cxxitimer::ScopedLabel tenant("tenant", "a");
+        burn(0.2);
+        {
+            cxxitimer::ScopedLabel stage(parse);
+            burn(0.1);
+        }
+    }
+    {
+        cxxitimer::ScopedLabel tenant("tenant", "b");
+        burn(0.1);
+    }
+    timer.stop();
+
+    std::vector<cxxitimer::ProfileSample> samples;
+    profiler.read(samples);
+    CHECK(samples.size() > 50);
+    CHECK(profiler.get_dropped() == 0);
+    CHECK(samples.front().depth > 0);
+
+    cxxitimer::LabelProfile profile;
+    profile.add(samples);
+
+    auto by_tenant = profile.get_cpu_by("tenant");
+    CHECK(by_tenant["a"] > by_tenant["b"]);
+    CHECK(by_tenant["b"] > 0.0);
+
+    auto by_stage = profile.get_cpu_by("stage");
+    CHECK(by_stage["parse"] > 0.0);
+    CHECK(by_stage[""] > by_stage["parse"]);
+
+    std::stringstream stream;
+    cxxitimer::write_profile_dump(stream, samples);
+    const auto dump = cxxitimer::read_profile_dump(stream);
+    CHECK(dump.maps.find("[stack]") != std::string::npos);
+    CHECK(dump.samples.size() == samples.size());
+    CHECK(dump.samples.back().depth == samples.back().depth);
+    CHECK(dump.samples.back().stack[0] == samples.back().stack[0]);
+    CHECK(dump.labels.at(parse).second == "parse");
+
+    // optional: keep the dump for the smoke test of the symbolization tool
+    if (argc > 1) {
+        std::ofstream file(argv[1], std::ios::binary);
+        cxxitimer::write_profile_dump(file, samples);
+        file.close();
+        CHECK(file);
+    }
+
+    return EXIT_SUCCESS;
+}
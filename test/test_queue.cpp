@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_queue_dispatcher.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+static int test_queue(cxxitimer::TimerQueue &queue) {
+    std::vector<int> order;
+
+    const auto a = queue.schedule(30ms, [&order] { order.push_back(3); });
+    const auto b = queue.schedule(10ms, [&order] { order.push_back(1); });
+    const auto c = queue.schedule(20ms, [&order] { order.push_back(2); });
+    const auto d = queue.schedule(5ms, [&order] { order.push_back(0); });
+    CHECK(queue.size() == 4);
+    CHECK(queue.next_deadline() == 5ms);
+
+    CHECK(queue.cancel(d));
+    CHECK(!queue.cancel(d));
+    CHECK(queue.reschedule(a, 15ms));
+    CHECK(queue.size() == 3);
+    CHECK(queue.next_deadline() == 10ms);
+
+    std::vector<cxxitimer::TimerQueue::callback_t> expired;
+    CHECK(queue.pop_expired(9ms, expired) == 0);
+    CHECK(queue.pop_expired(20ms, expired) == 3);
+    for (auto &callback : expired)
+        callback();
+
+    CHECK((order == std::vector<int> {1, 3, 2}));
+    CHECK(queue.empty());
+    CHECK(!queue.next_deadline());
+    CHECK(!queue.reschedule(b, 1ms));
+    CHECK(!queue.cancel(c));
+    return EXIT_SUCCESS;
+}
+
+static int test_heap_queue() {
+    cxxitimer::HeapTimerQueue                      queue;
+    std::vector<cxxitimer::TimerQueue::timer_id>   ids;
+    std::vector<std::chrono::nanoseconds>          deadlines;
+    std::vector<std::chrono::nanoseconds>          fired;
+    std::vector<cxxitimer::TimerQueue::callback_t> expired;
+
+    // pseudo random deadlines
+    unsigned state = 1;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        state = state * 1103515245U + 12345U;
+        deadlines.emplace_back(state % 100000);
+        ids.push_back(queue.schedule(deadlines.back(), [&fired, &deadlines, i] { fired.push_back(deadlines[i]); }));
+    }
+
+    // cancel every second timer (triggers compaction), move every third timer
+    for (std::size_t i = 0; i < ids.size(); i += 2)
+        CHECK(queue.cancel(ids[i]));
+    for (std::size_t i = 1; i < ids.size(); i += 6) {
+        deadlines[i] = std::chrono::nanoseconds(i * 7 % 100000);
+        CHECK(queue.reschedule(ids[i], deadlines[i]));
+    }
+    CHECK(queue.size() == 500);
+
+    CHECK(queue.pop_expired(std::chrono::nanoseconds(100000), expired) == 500);
+    for (auto &callback : expired)
+        callback();
+    CHECK(queue.empty());
+
+    // exact order
+    for (std::size_t i = 1; i < fired.size(); ++i)
+        CHECK(fired[i - 1] <= fired[i]);
+    return EXIT_SUCCESS;
+}
+
+static int test_cpu_time_dispatcher() {
+    cxxitimer::ITimer_Virtual    timer;
+    cxxitimer::OrderedTimerQueue queue;
+    cxxitimer::QueueDispatcher   dispatcher(timer, queue);
+    std::atomic<bool>            done {false};
+    std::vector<int>             order;
+    const auto                   start = dispatcher.now();
+
+    dispatcher.schedule_at(start + 60ms, [&] {
+        order.push_back(2);
+        done = true;
+    });
+    dispatcher.schedule_at(start + 20ms, [&] { order.push_back(1); });
+    const auto canceled = dispatcher.schedule_at(start + 40ms, [&] { order.push_back(-1); });
+    CHECK(dispatcher.cancel(canceled));
+
+    // consume user CPU time
+    std::thread worker([&done] {
+        volatile unsigned long x = 0;
+        while (!done)
+            x = x + 1;
+    });
+
+    while (!done)
+        dispatcher.wait_and_dispatch({0, 100000});
+    worker.join();
+
+    CHECK((order == std::vector<int> {1, 2}));
+    CHECK(dispatcher.now() - start >= 60ms);
+    CHECK(dispatcher.size() == 0);
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    cxxitimer::OrderedTimerQueue ordered_queue;
+    if (test_queue(ordered_queue) != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    cxxitimer::HeapTimerQueue heap_queue;
+    if (test_queue(heap_queue) != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (test_heap_queue() != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    return test_cpu_time_dispatcher();
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+#include "cxxitimer_shared_tick.hpp"
+#include "cxxitimer_speed_coordinator.hpp"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+//* number of writer processes
+static constexpr int WRITERS = 4;
+
+//* number of changes per writer
+static constexpr int CHANGES = 1000;
+
+static int test_speed_coordinator() {
+    const std::string name = "/cxxitimer_test_speed_" + std::to_string(getpid());
+
+    cxxitimer::SpeedCoordinator coordinator(name);
+    cxxitimer::ITimer_Virtual   timer(1.0);
+    cxxitimer::SpeedFollower    follower(timer, name);
+    CHECK(follower.get_change().generation == 0);
+    CHECK(!follower.poll());
+
+    // writers in other processes (sharing the mapping) and in this process
+    std::vector<pid_t> children;
+    for (int i = 0; i < WRITERS; ++i) {
+        const auto pid = fork();
+        if (pid == 0) {
+            for (int n = 0; n < CHANGES; ++n)
+                coordinator.schedule(2.0, {0, 0});
+            _exit(EXIT_SUCCESS);
+        }
+        children.push_back(pid);
+    }
+    for (int n = 0; n < CHANGES; ++n)
+        coordinator.schedule(2.0, {0, 0});
+
+    for (const auto pid : children) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+    }
+
+    // no change is lost
+    CHECK(coordinator.get_change().generation == (WRITERS + 1) * CHANGES);
+
+    // due change is applied once
+    CHECK(follower.poll());
+    CHECK(!follower.poll());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 2.0));
+
+    // change in the future is not applied yet
+    const auto generation = coordinator.schedule(0.5, {10, 0});
+    CHECK(follower.get_change().generation == generation);
+    CHECK(!follower.poll());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 2.0));
+
+    return EXIT_SUCCESS;
+}
+
+static int test_shared_tick() {
+    const std::string name = "/cxxitimer_test_tick_" + std::to_string(getpid());
+
+    cxxitimer::ITimer_Real       timer(0.005);
+    cxxitimer::SharedTickSource source(timer, name);
+
+    // the object exists: a second source must not take it over
+    bool thrown = false;
+    try {
+        cxxitimer::SharedTickSource other(timer, name);
+    } catch (const std::system_error &e) { thrown = e.code() == std::errc::file_exists; }
+    CHECK(thrown);
+
+    // reader in another process
+    const auto pid = fork();
+    if (pid == 0) {
+        cxxitimer::SharedTickReader reader(name);
+
+        std::uint64_t ticks = reader.get_ticks();
+        while (ticks < 5)
+            ticks = reader.wait_for_tick(ticks);
+
+        const auto snapshot = reader.read();
+        bool       ok       = snapshot.ticks > 0 && snapshot.ticks <= reader.get_ticks();
+        ok                  = ok && snapshot.monotonic_nsec > 0 && !std::islessgreater(snapshot.speed_factor, 1.0);
+        _exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    timer.start();
+    int status = 0;
+    waitpid(pid, &status, 0);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+
+    // a speed factor that is set directly on the timer is published with the next tick
+    cxxitimer::SharedTickReader reader(name);
+    timer.set_speed_factor(2.0);
+    reader.wait_for_tick(reader.get_ticks());
+    reader.wait_for_tick(reader.get_ticks());
+    CHECK(!std::islessgreater(reader.read().speed_factor, 2.0));
+
+    timer.stop();
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_speed_coordinator() == EXIT_SUCCESS);
+    CHECK(test_shared_tick() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer.hpp"
+#include "cxxitimer_work_slicer.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+
+static int test_work_slicer() {
+    cxxitimer::ITimer_Virtual timer(1.0);
+    cxxitimer::WorkSlicer     slicer(timer, std::chrono::seconds(1));
+
+    // job that removes itself: its state must stay valid until it returns
+    int                           self_runs = 0;
+    cxxitimer::WorkSlicer::job_id self_id   = 0;
+    auto                          state     = std::make_shared<int>(42);
+
+    self_id = slicer.add_job([&slicer, &self_runs, &self_id, state](const cxxitimer::SliceBudget &) {
+        ++self_runs;
+        slicer.remove_job(self_id);
+        return *state != 42;
+    });
+    state.reset();
+
+    // job that is complete after three slices
+    int counted = 0;
+    slicer.add_job([&counted](const cxxitimer::SliceBudget &) { return ++counted == 3; });
+
+    // job that removes the job that follows it
+    int                           victim_runs = 0;
+    cxxitimer::WorkSlicer::job_id victim_id   = 0;
+
+    slicer.add_job([&slicer, &victim_id](const cxxitimer::SliceBudget &) {
+        slicer.remove_job(victim_id);
+        return true;
+    });
+    victim_id = slicer.add_job([&victim_runs](const cxxitimer::SliceBudget &) {
+        ++victim_runs;
+        return false;
+    });
+
+    CHECK(slicer.size() == 4);
+    CHECK(slicer.run_slice() == 3);
+    CHECK(self_runs == 1);
+    CHECK(victim_runs == 0);
+    CHECK(slicer.size() == 1);
+    CHECK(!slicer.remove_job(self_id));
+    CHECK(!slicer.remove_job(victim_id));
+
+    CHECK(slicer.run_slice() == 1);
+    CHECK(slicer.run_slice() == 1);
+    CHECK(counted == 3);
+    CHECK(slicer.size() == 0);
+    CHECK(slicer.run_slice() == 0);
+    CHECK(self_runs == 1);
+
+    return EXIT_SUCCESS;
+}
+
+int main() {
+    CHECK(test_work_slicer() == EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_speed_coordinator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+static std::int64_t monotonic_nsec() {
+    timespec now {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return std::int64_t {now.tv_sec} * 1000000000 + now.tv_nsec;
+}
+
+int main() {
+    // ticks are not handled in this test
+    signal(SIGALRM, SIG_IGN);
+
+    const std::string name = "/cxxitimer_test_speed_" + std::to_string(getpid());
+
+    cxxitimer::SpeedCoordinator coordinator(name);
+    cxxitimer::ITimer_Real      timer(10.0);  // no expiration during the test
+    cxxitimer::SpeedFollower    follower(timer, name);
+
+    timer.start();
+    const auto start = monotonic_nsec();
+
+    // two changes are due before the follower polls
+    coordinator.schedule(2.0, {0, 20000});
+    const auto first = coordinator.get_change();
+    std::this_thread::sleep_for(50ms);
+    coordinator.schedule(4.0, {0, 20000});
+    const auto second = coordinator.get_change();
+    std::this_thread::sleep_for(100ms);
+
+    CHECK(follower.poll());
+    const auto now   = monotonic_nsec();
+    const auto value = timer.get_timer_value();
+    CHECK(!follower.poll());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 4.0));
+
+    // both changes are applied as of their instants
+    const auto elapsed  = static_cast<double>(first.apply_at_nsec - start) +
+                          static_cast<double>(second.apply_at_nsec - first.apply_at_nsec) * 2.0 +
+                          static_cast<double>(now - second.apply_at_nsec) * 4.0;
+    const auto expected = (10.0 - elapsed / 1e9) / 4.0;
+    CHECK(std::abs(cxxitimer::timeval_to_double(value) - expected) < 0.005);
+
+    // a pending change is replaced
+    coordinator.schedule(0.5, {1, 0});
+    coordinator.schedule(1.0, {0, 10000});
+    CHECK(coordinator.get_change().generation == second.generation + 2);
+    std::this_thread::sleep_for(20ms);
+    CHECK(follower.poll());
+    CHECK(!std::islessgreater(timer.get_speed_factor(), 1.0));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_tick.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static volatile sig_atomic_t x = 0;
+static void                  handler(int) {
+    ++x;
+}
+
+int main() {
+    // previously installed handler must still be called
+    struct sigaction sa {};
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = handler;
+    int tmp       = sigaction(SIGALRM, &sa, nullptr);
+    if (tmp != 0) {
+        perror("sigaction");
+        return EXIT_FAILURE;
+    }
+
+    cxxitimer::ITimer_Real   timer(0.05);
+    cxxitimer::TickBroadcast broadcast(timer);
+
+    static constexpr int TICKS   = 10;
+    static constexpr int THREADS = 4;
+
+    std::atomic<int>         done {0};
+    std::vector<std::thread> threads;
+    threads.reserve(THREADS);
+    for (int i = 0; i < THREADS; ++i) {
+        threads.emplace_back([&broadcast, &done] {
+            std::uint32_t seq = broadcast.get_sequence();
+            for (int t = 0; t < TICKS; ++t)
+                seq = broadcast.wait_for_tick(seq);
+            ++done;
+        });
+    }
+
+    timer.start();
+    for (auto &thread : threads)
+        thread.join();
+    timer.stop();
+
+    CHECK(done == THREADS);
+
+    CHECK(x >= TICKS && static_cast<std::uint32_t>(x) == broadcast.get_sequence());
+
+    // timeout
+    const auto seq = broadcast.get_sequence();
+    CHECK(broadcast.wait_for_tick(seq, {0, 100000}) == seq);
+}
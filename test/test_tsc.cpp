@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "check.hpp"
+#include "cxxitimer_tsc.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+int main() {
+    using cxxitimer::TscClock;
+
+    // switch from CLOCK_MONOTONIC to the TSC
+    auto last = TscClock::now();
+    TscClock::calibrate(1ms);
+    CHECK(TscClock::now() >= last);
+    CHECK(TscClock::is_calibrated() == TscClock::is_invariant());
+
+    const auto offset = []() {
+        return TscClock::now().time_since_epoch() - std::chrono::steady_clock::now().time_since_epoch();
+    };
+
+    // new calibration points (with slightly different rates) must not step the clock back
+    std::size_t recalibrations = 0;
+    const auto  start_offset   = offset();
+    const auto  start          = std::chrono::steady_clock::now();
+    const auto  end            = start + 300ms;
+    auto        next           = start;
+    while (std::chrono::steady_clock::now() < end) {
+        if (std::chrono::steady_clock::now() >= next) {
+            if (recalibrations++ % 2) TscClock::recalibrate();
+            else
+                TscClock::calibrate(1ms);
+            next += 2ms;
+        }
+
+        const auto now = TscClock::now();
+        CHECK(now >= last);
+        last = now;
+    }
+    CHECK(recalibrations > 10);
+
+    if (!TscClock::is_calibrated()) return EXIT_SUCCESS;
+
+    // the offset changes by at most the slew limit (plus the error of the short rate measurements)
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const auto drift   = std::chrono::duration<double>(offset() - start_offset).count();
+    CHECK(std::abs(drift) < (TscClock::MAX_SLEW_PPM + 1000.0) / 1e6 * elapsed + 20e-6);
+
+    // the reported frequency is the measured rate (not changed by the offset correction)
+    const auto start_tsc  = TscClock::read_tsc();
+    const auto start_time = std::chrono::steady_clock::now();
+    TscClock::calibrate(50ms);
+    const auto frequency = static_cast<double>(TscClock::read_tsc() - start_tsc) /
+                           std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    CHECK(std::abs(TscClock::get_frequency() / frequency - 1.0) < 1e-3);
+
+    // during the slew, the clock rate differs by at most the slew limit (plus the measurement error)
+    const auto slew_start       = std::chrono::steady_clock::now();
+    const auto slew_start_clock = TscClock::now();
+    std::this_thread::sleep_for(100ms);
+    const auto slew_clock = std::chrono::duration<double>(TscClock::now() - slew_start_clock).count();
+    const auto slew_time  = std::chrono::duration<double>(std::chrono::steady_clock::now() - slew_start).count();
+    CHECK(std::abs(slew_clock / slew_time - 1.0) < (TscClock::MAX_SLEW_PPM + 500.0) / 1e6);
+
+    return EXIT_SUCCESS;
+}
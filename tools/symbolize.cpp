@@ -0,0 +1,411 @@
+/*
+ * Copyright (C) 2026 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Offline symbolization of profile dumps (see cxxitimer_profile_dump.hpp).
+ *
+ * usage: cxxitimer_symbolize [--flat] [--labels] [--no-lines] DUMP
+ *
+ * The raw addresses of the samples are mapped to the binaries with the /proc/self/maps snapshot of the dump.
+ * Function names are taken from the ELF symbol tables (.symtab, .dynsym as fallback). Source lines are resolved from
+ * the DWARF line info by addr2line (binutils).
+ *
+ * Default output are folded stacks (outermost frame first) weighted with the CPU time in usec. They can be passed to
+ * flamegraph.pl directly. --flat prints the self and total CPU time per function instead.
+ */
+
+#include "cxxitimer_profile_dump.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cxxabi.h>
+#include <elf.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//* maximum number of addresses per addr2line invocation
+static constexpr std::size_t ADDR2LINE_BATCH = 128;
+
+//* executable mapping of the profiled process
+struct Mapping {
+    std::uint64_t start;
+    std::uint64_t end;
+    std::uint64_t offset;
+    std::string   path;
+};
+
+//* function symbol
+struct Symbol {
+    std::uint64_t address;
+    std::uint64_t size;
+    std::string   name;
+};
+
+/**
+ * @brief symbol table and load segments of an ELF file (ELF32 and ELF64, native byte order)
+ */
+class ElfFile {
+private:
+    //* PT_LOAD segment
+    struct Segment {
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint64_t vaddr;
+    };
+
+    std::vector<char>    data;
+    std::vector<Segment> segments;
+    std::vector<Symbol>  symbols;
+
+public:
+    explicit ElfFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) throw std::runtime_error("failed to open " + path);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        if (data.size() < EI_NIDENT || std::memcmp(data.data(), ELFMAG, SELFMAG) != 0)
+            throw std::runtime_error(path + " is not an ELF file");
+
+        switch (data[EI_CLASS]) {
+            case ELFCLASS32: load<Elf32_Ehdr, Elf32_Phdr, Elf32_Shdr, Elf32_Sym>(); break;
+            case ELFCLASS64: load<Elf64_Ehdr, Elf64_Phdr, Elf64_Shdr, Elf64_Sym>(); break;
+            default: throw std::runtime_error(path + ": unsupported ELF class");
+        }
+
+        data.clear();
+        data.shrink_to_fit();
+    }
+
+    //* translate a file offset to the virtual address of the ELF file
+    [[nodiscard]] std::optional<std::uint64_t> to_vaddr(std::uint64_t offset) const {
+        for (const auto &segment : segments)
+            if (offset >= segment.offset && offset < segment.offset + segment.size)
+                return offset - segment.offset + segment.vaddr;
+        return std::nullopt;
+    }
+
+    //* find the function that contains a virtual address
+    [[nodiscard]] const Symbol *find_symbol(std::uint64_t vaddr) const {
+        auto it = std::upper_bound(symbols.begin(), symbols.end(), vaddr, [](std::uint64_t value, const Symbol &sym) {
+            return value < sym.address;
+        });
+        if (it == symbols.begin()) return nullptr;
+        --it;
+        if (it->size != 0 && vaddr >= it->address + it->size) return nullptr;
+        return &*it;
+    }
+
+private:
+    template <typename T>
+    [[nodiscard]] T read(std::uint64_t offset) const {
+        if (offset > data.size() || data.size() - offset < sizeof(T)) throw std::runtime_error("truncated ELF file");
+        T value;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    [[nodiscard]] std::string read_string(std::uint64_t offset) const {
+        if (offset >= data.size()) throw std::runtime_error("truncated ELF file");
+        const auto *str = data.data() + offset;
+        return std::string(str, strnlen(str, data.size() - offset));
+    }
+
+    template <typename Ehdr, typename Phdr, typename Shdr, typename Sym>
+    void load() {
+        const auto header = read<Ehdr>(0);
+
+        for (std::uint64_t i = 0; i < header.e_phnum; ++i) {
+            const auto phdr = read<Phdr>(header.e_phoff + i * header.e_phentsize);
+            if (phdr.p_type == PT_LOAD) segments.push_back(Segment {phdr.p_offset, phdr.p_filesz, phdr.p_vaddr});
+        }
+
+        std::vector<Shdr> sections;
+        for (std::uint64_t i = 0; i < header.e_shnum; ++i)
+            sections.push_back(read<Shdr>(header.e_shoff + i * header.e_shentsize));
+
+        // prefer the full symbol table, stripped binaries only have the dynamic one
+        for (const auto type : {SHT_SYMTAB, SHT_DYNSYM}) {
+            for (const auto &section : sections) {
+                if (section.sh_type != static_cast<decltype(section.sh_type)>(type) || section.sh_entsize == 0 ||
+                    section.sh_link >= sections.size())
+                    continue;
+
+                const auto &strtab = sections[section.sh_link];
+                for (std::uint64_t off = 0; off + section.sh_entsize <= section.sh_size; off += section.sh_entsize) {
+                    const auto sym       = read<Sym>(section.sh_offset + off);
+                    const auto sym_type  = sym.st_info & 0xf;
+                    const bool function  = sym_type == STT_FUNC || sym_type == STT_GNU_IFUNC;
+                    const bool undefined = sym.st_shndx == SHN_UNDEF;
+                    if (!function || undefined || sym.st_value == 0) continue;
+                    symbols.push_back(Symbol {sym.st_value, sym.st_size, read_string(strtab.sh_offset + sym.st_name)});
+                }
+            }
+
+            if (!symbols.empty()) break;
+        }
+
+        std::sort(symbols.begin(), symbols.end(), [](const Symbol &a, const Symbol &b) {
+            return a.address < b.address;
+        });
+    }
+};
+
+//* parse the executable mappings of a /proc/self/maps snapshot
+static std::vector<Mapping> parse_maps(const std::string &maps) {
+    std::vector<Mapping> result;
+    std::istringstream   stream(maps);
+    std::string          line;
+    while (std::getline(stream, line)) {
+        std::istringstream fields(line);
+        Mapping            mapping {};
+        char               dash = 0;
+        std::string        perms;
+        std::string        dev;
+        std::uint64_t      inode = 0;
+        fields >> std::hex >> mapping.start >> dash >> mapping.end >> perms >> mapping.offset >> dev >> std::dec >>
+                inode;
+        if (!fields || dash != '-' || perms.find('x') == std::string::npos) continue;
+
+        std::getline(fields >> std::ws, mapping.path);
+        if (mapping.path.empty()) continue;
+        result.push_back(std::move(mapping));
+    }
+    return result;
+}
+
+static std::string demangle(const std::string &name) {
+    int  status = 0;
+    auto demangled =
+            std::unique_ptr<char, decltype(&std::free)>(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status),
+                                                        &std::free);
+    return status == 0 && demangled ? std::string(demangled.get()) : name;
+}
+
+static std::string hex(std::uint64_t value) {
+    std::ostringstream stream;
+    stream << "0x" << std::hex << value;
+    return stream.str();
+}
+
+static std::string basename(const std::string &path) {
+    const auto pos = path.rfind('/');
+    return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+//* resolve source lines with addr2line (result: file:line or empty per address)
+static std::vector<std::string> resolve_lines(const std::string &path, const std::vector<std::uint64_t> &vaddrs) {
+    std::string quoted = "'";
+    for (const char c : path)
+        quoted += c == '\'' ? std::string("'\\''") : std::string(1, c);
+    quoted += "'";
+
+    std::vector<std::string> result;
+    for (std::size_t first = 0; first < vaddrs.size(); first += ADDR2LINE_BATCH) {
+        const auto  last    = std::min(first + ADDR2LINE_BATCH, vaddrs.size());
+        std::string command = "addr2line -e " + quoted;
+        for (auto i = first; i < last; ++i)
+            command += ' ' + hex(vaddrs[i]);
+        command += " 2>/dev/null";
+
+        auto *pipe = popen(command.c_str(), "r");
+        if (!pipe) break;
+
+        char line[4096];
+        while (result.size() < last && std::fgets(line, sizeof(line), pipe)) {
+            std::string location(line);
+            location = location.substr(0, location.find_first_of(" \n"));
+            if (location.rfind("??", 0) == 0 || location.find(":?") != std::string::npos ||
+                location.size() < 2 || location.compare(location.size() - 2, 2, ":0") == 0)
+                location.clear();
+            result.push_back(basename(location));
+        }
+        pclose(pipe);
+
+        // addr2line not available or failed
+        if (result.size() < last) break;
+    }
+
+    result.resize(vaddrs.size());
+    return result;
+}
+
+//* symbolize addresses (result: address -> frame name)
+static std::unordered_map<std::uint64_t, std::string> symbolize(const std::set<std::uint64_t> &addresses,
+                                                                const std::vector<Mapping> &maps,
+                                                                bool                        lines) {
+    std::unordered_map<std::uint64_t, std::string>                  result;
+    std::map<std::string, std::vector<std::pair<std::uint64_t, std::uint64_t>>> by_file;
+
+    for (const auto address : addresses) {
+        const auto mapping = std::find_if(maps.begin(), maps.end(), [address](const Mapping &m) {
+            return address >= m.start && address < m.end;
+        });
+        if (mapping == maps.end()) {
+            result.emplace(address, hex(address));
+            continue;
+        }
+        by_file[mapping->path].emplace_back(address, address - mapping->start + mapping->offset);
+    }
+
+    for (const auto &[path, entries] : by_file) {
+        // pseudo files (e.g. [vdso]) are not symbolized
+        std::unique_ptr<ElfFile> elf;
+        try {
+            if (path.front() == '/') elf = std::make_unique<ElfFile>(path);
+        } catch (const std::exception &e) { std::cerr << "warning: " << e.what() << '\n'; }
+
+        std::vector<std::uint64_t> vaddrs;
+        vaddrs.reserve(entries.size());
+        for (const auto &[address, offset] : entries)
+            vaddrs.push_back(elf ? elf->to_vaddr(offset).value_or(offset) : offset);
+
+        std::vector<std::string> locations(entries.size());
+        if (elf && lines) locations = resolve_lines(path, vaddrs);
+
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            const auto *symbol = elf ? elf->find_symbol(vaddrs[i]) : nullptr;
+
+            std::string name = symbol ? demangle(symbol->name) : basename(path) + '+' + hex(entries[i].second);
+            if (!locations[i].empty()) name += " (" + locations[i] + ')';
+            std::replace(name.begin(), name.end(), ';', ':');
+            result.emplace(entries[i].first, std::move(name));
+        }
+    }
+
+    return result;
+}
+
+//* address of a frame (return addresses point behind the call instruction)
+static std::uint64_t frame_address(const cxxitimer::ProfileSample &sample, std::size_t index) {
+    const std::uint64_t address = reinterpret_cast<std::uintptr_t>(sample.stack[index]);
+    return index > 0 && address > 0 ? address - 1 : address;
+}
+
+static void print_usage(const char *name) {
+    std::cerr << "usage: " << name << " [--flat] [--labels] [--no-lines] DUMP\n"
+              << "  --flat      print self and total CPU time per function instead of folded stacks\n"
+              << "  --labels    prefix the folded stacks with the labels of the samples\n"
+              << "  --no-lines  do not resolve source lines (addr2line)\n";
+}
+
+int main(int argc, char **argv) {
+    bool        flat   = false;
+    bool        labels = false;
+    bool        lines  = true;
+    std::string dump_path;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        if (arg == "--flat") flat = true;
+        else if (arg == "--labels") labels = true;
+        else if (arg == "--no-lines") lines = false;
+        else if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (dump_path.empty() && arg.front() != '-') dump_path = arg;
+        else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (dump_path.empty()) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    cxxitimer::ProfileDump dump;
+    try {
+        std::ifstream file(dump_path, std::ios::binary);
+        if (!file) throw std::runtime_error("failed to open " + dump_path);
+        dump = cxxitimer::read_profile_dump(file);
+    } catch (const std::exception &e) {
+        std::cerr << dump_path << ": " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::set<std::uint64_t> addresses;
+    for (const auto &sample : dump.samples)
+        for (std::size_t i = 0; i < sample.depth; ++i)
+            addresses.insert(frame_address(sample, i));
+
+    const auto names = symbolize(addresses, parse_maps(dump.maps), lines);
+
+    // CPU time in usec
+    const auto weight = [](const cxxitimer::ProfileSample &sample) {
+        return static_cast<std::uint64_t>(std::max<std::int64_t>(sample.period / 1000, 1));
+    };
+
+    if (flat) {
+        std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> functions;  // self, total
+        std::uint64_t                                                   total = 0;
+        for (const auto &sample : dump.samples) {
+            if (sample.depth == 0) continue;
+            const auto w = weight(sample);
+            total += w;
+            functions[names.at(frame_address(sample, 0))].first += w;
+
+            // count recursive functions once per sample
+            std::set<std::string> seen;
+            for (std::size_t i = 0; i < sample.depth; ++i) {
+                const auto &name = names.at(frame_address(sample, i));
+                if (seen.insert(name).second) functions[name].second += w;
+            }
+        }
+
+        std::vector<std::pair<std::string, std::pair<std::uint64_t, std::uint64_t>>> sorted(functions.begin(),
+                                                                                            functions.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+            return a.second.first != b.second.first ? a.second.first > b.second.first
+                                                    : a.second.second > b.second.second;
+        });
+
+        const auto percent = [total](std::uint64_t value) {
+            return total ? 100.0 * static_cast<double>(value) / static_cast<double>(total) : 0.0;
+        };
+
+        std::cout << "   self%   total%  function\n" << std::fixed << std::setprecision(2);
+        for (const auto &[name, time] : sorted)
+            std::cout << std::setw(8) << percent(time.first) << ' ' << std::setw(8) << percent(time.second) << "  "
+                      << name << '\n';
+        return EXIT_SUCCESS;
+    }
+
+    std::map<std::string, std::uint64_t> folded;
+    for (const auto &sample : dump.samples) {
+        std::string stack;
+        if (labels) {
+            for (std::size_t i = 0; i < sample.label_count; ++i) {
+                const auto it = dump.labels.find(sample.labels[i]);
+                if (it == dump.labels.end()) continue;
+                stack += it->second.first + '=' + it->second.second + ';';
+            }
+        }
+
+        for (std::size_t i = sample.depth; i > 0; --i) {
+            stack += names.at(frame_address(sample, i - 1));
+            if (i > 1) stack += ';';
+        }
+
+        if (!stack.empty()) folded[stack] += weight(sample);
+    }
+
+    for (const auto &[stack, time] : folded)
+        std::cout << stack << ' ' << time << '\n';
+
+    return EXIT_SUCCESS;
+}